@@ -0,0 +1,359 @@
+#include "field_access_proxy/field_access_proxy.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ostream>
+#include <span>
+#include <streambuf>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace field_access_proxy;
+
+namespace {
+
+constexpr std::endian opposite_endian {
+    std::endian::native == std::endian::little ? std::endian::big : std::endian::little};
+
+#pragma pack(push, 1)
+
+struct Packet {
+    std::uint16_t major_minor_version {0x1234};
+    std::uint32_t native_count {0};
+    std::uint32_t swapped_count {0};
+    std::uint32_t first_item[1];
+};
+
+#pragma pack(pop)
+
+namespace vt {
+
+constexpr auto version {MakeField("The version", &Packet::major_minor_version)};
+constexpr auto native_count {MakeField("The number of items", &Packet::native_count)};
+constexpr auto swapped_count {
+    MakeField<opposite_endian>("The number of items", &Packet::swapped_count)};
+constexpr auto dynamic_swapped_count {
+    MakeField("The number of items", &Packet::swapped_count, opposite_endian)};
+
+constexpr auto major_version {MakeBitField("The major version", version, CHAR_BIT, CHAR_BIT)};
+constexpr auto static_major_version {
+    MakeBitField<CHAR_BIT, CHAR_BIT, std::uint8_t>("The major version", version)};
+
+constexpr auto is_version_first_bit_set {
+    MakeBoolField("Whether the first bit of the version is set", version, 0)};
+constexpr auto static_is_version_first_bit_set {
+    MakeBoolField<0>("Whether the first bit of the version is set", version)};
+
+constexpr auto items {MakeFlexibleArrayField("Items", &Packet::first_item, native_count)};
+
+}  // namespace vt
+
+//! A stream buffer that discards all output.
+class NullBuffer : public std::streambuf {
+protected:
+    int_type overflow(const int_type ch) override {
+        return ch;
+    }
+
+    std::streamsize xsputn(const char*, const std::streamsize count) override {
+        return count;
+    }
+};
+
+std::vector<Packet> MakePackets(const std::size_t count) {
+    std::vector<Packet> pkgs(count);
+    for (std::size_t i {0}; i != count; ++i) {
+        auto& pkg {pkgs[i]};
+        pkg.major_minor_version = static_cast<std::uint16_t>(i);
+        pkg.native_count = static_cast<std::uint32_t>(i);
+        pkg.swapped_count = std::byteswap(static_cast<std::uint32_t>(i));
+    }
+
+    return pkgs;
+}
+
+//! A packet followed by its flexible array elements in an owned buffer.
+class FlexiblePacket {
+public:
+    explicit FlexiblePacket(const std::size_t count) :
+        buffer_ {std::make_unique<std::byte[]>(vt::items.GetByteSize(count))} {
+        auto& pkg {Get()};
+        pkg = {};
+        pkg.native_count = static_cast<std::uint32_t>(count);
+        std::iota(pkg.first_item, pkg.first_item + count, 0);
+    }
+
+    Packet& Get() noexcept {
+        return *reinterpret_cast<Packet*>(buffer_.get());
+    }
+
+private:
+    std::unique_ptr<std::byte[]> buffer_;
+};
+
+void BatchSizes(benchmark::internal::Benchmark* const bench) {
+    bench->RangeMultiplier(8)->Range(8, 8 << 12);
+}
+
+void ItemCounts(benchmark::internal::Benchmark* const bench) {
+    bench->RangeMultiplier(8)->Range(1, 1 << 12);
+}
+
+template <typename GetFunc>
+void GetBench(benchmark::State& state, GetFunc get) {
+    const auto pkgs {MakePackets(static_cast<std::size_t>(state.range(0)))};
+    for (auto _ : state) {
+        std::uint64_t sum {0};
+        for (const auto& pkg : pkgs) {
+            sum += get(pkg);
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename SetFunc>
+void SetBench(benchmark::State& state, SetFunc set) {
+    auto pkgs {MakePackets(static_cast<std::size_t>(state.range(0)))};
+    for (auto _ : state) {
+        std::uint32_t val {0};
+        for (auto& pkg : pkgs) {
+            set(pkg, val++);
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename ExtractFunc>
+void ExtractColumnBench(benchmark::State& state, ExtractFunc extract) {
+    const auto pkgs {MakePackets(static_cast<std::size_t>(state.range(0)))};
+    std::vector<std::uint32_t> vals(pkgs.size());
+    for (auto _ : state) {
+        extract(std::span {pkgs}, std::span {vals});
+        benchmark::DoNotOptimize(vals.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename SumFunc>
+void FlexibleGetBench(benchmark::State& state, SumFunc sum_items) {
+    FlexiblePacket pkg {static_cast<std::size_t>(state.range(0))};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_items(std::as_const(pkg.Get())));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename SetFunc>
+void FlexibleSetBench(benchmark::State& state, SetFunc set_items) {
+    const auto count {static_cast<std::size_t>(state.range(0))};
+    FlexiblePacket pkg {count};
+    std::vector<std::uint32_t> vals(count);
+    std::iota(vals.begin(), vals.end(), 1);
+    for (auto _ : state) {
+        set_items(pkg.Get(), std::span<const std::uint32_t> {vals});
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename FormatFunc>
+void FormatBench(benchmark::State& state, FormatFunc format) {
+    const auto pkgs {MakePackets(1)};
+    std::string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        format(buffer, pkgs.front());
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+
+template <typename PrintFunc>
+void PrintBench(benchmark::State& state, PrintFunc print) {
+    const auto pkgs {MakePackets(1)};
+    NullBuffer null_buffer;
+    std::ostream os {&null_buffer};
+    std::string buffer;
+    for (auto _ : state) {
+        print(os, buffer, pkgs.front());
+    }
+}
+
+}  // namespace
+
+// Regular fields in native endianness.
+BENCHMARK_CAPTURE(GetBench, raw_native, [](const Packet& pkg) noexcept {
+    return pkg.native_count;
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(GetBench, proxy_native, [](const Packet& pkg) noexcept {
+    return vt::native_count.Get(pkg);
+})->Apply(BatchSizes);
+
+BENCHMARK_CAPTURE(SetBench, raw_native, [](Packet& pkg, const std::uint32_t val) noexcept {
+    pkg.native_count = val;
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(SetBench, proxy_native, [](Packet& pkg, const std::uint32_t val) noexcept {
+    vt::native_count.Set(pkg, val);
+})->Apply(BatchSizes);
+
+// Regular fields in swapped endianness.
+BENCHMARK_CAPTURE(GetBench, raw_swapped, [](const Packet& pkg) noexcept {
+    return std::byteswap(pkg.swapped_count);
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(GetBench, proxy_swapped, [](const Packet& pkg) noexcept {
+    return vt::swapped_count.Get(pkg);
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(GetBench, proxy_dynamic_swapped, [](const Packet& pkg) noexcept {
+    return vt::dynamic_swapped_count.Get(pkg);
+})->Apply(BatchSizes);
+
+BENCHMARK_CAPTURE(SetBench, raw_swapped, [](Packet& pkg, const std::uint32_t val) noexcept {
+    pkg.swapped_count = std::byteswap(val);
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(SetBench, proxy_swapped, [](Packet& pkg, const std::uint32_t val) noexcept {
+    vt::swapped_count.Set(pkg, val);
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(SetBench, proxy_dynamic_swapped,
+                  [](Packet& pkg, const std::uint32_t val) noexcept {
+                      vt::dynamic_swapped_count.Set(pkg, val);
+                  })
+    ->Apply(BatchSizes);
+
+// Bit fields.
+BENCHMARK_CAPTURE(GetBench, raw_bit_field, [](const Packet& pkg) noexcept {
+    return static_cast<std::uint8_t>(pkg.major_minor_version >> CHAR_BIT);
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(GetBench, proxy_bit_field, [](const Packet& pkg) noexcept {
+    return vt::major_version.Get(pkg);
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(GetBench, proxy_static_bit_field, [](const Packet& pkg) noexcept {
+    return vt::static_major_version.Get(pkg);
+})->Apply(BatchSizes);
+
+BENCHMARK_CAPTURE(SetBench, raw_bit_field, [](Packet& pkg, const std::uint32_t val) noexcept {
+    pkg.major_minor_version = static_cast<std::uint16_t>((pkg.major_minor_version & 0x00FF)
+                                                         | ((val & 0xFF) << CHAR_BIT));
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(SetBench, proxy_bit_field, [](Packet& pkg, const std::uint32_t val) noexcept {
+    vt::major_version.Set(pkg, static_cast<std::uint16_t>(val & 0xFF));
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(SetBench, proxy_static_bit_field,
+                  [](Packet& pkg, const std::uint32_t val) noexcept {
+                      vt::static_major_version.Set(pkg, static_cast<std::uint8_t>(val));
+                  })
+    ->Apply(BatchSizes);
+
+// Boolean fields.
+BENCHMARK_CAPTURE(GetBench, raw_bool_field, [](const Packet& pkg) noexcept {
+    return (pkg.major_minor_version & 1) != 0;
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(GetBench, proxy_bool_field, [](const Packet& pkg) noexcept {
+    return vt::is_version_first_bit_set.Get(pkg);
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(GetBench, proxy_static_bool_field, [](const Packet& pkg) noexcept {
+    return vt::static_is_version_first_bit_set.Get(pkg);
+})->Apply(BatchSizes);
+
+BENCHMARK_CAPTURE(SetBench, raw_bool_field, [](Packet& pkg, const std::uint32_t val) noexcept {
+    pkg.major_minor_version =
+        static_cast<std::uint16_t>((pkg.major_minor_version & ~1) | (val & 1));
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(SetBench, proxy_bool_field, [](Packet& pkg, const std::uint32_t val) noexcept {
+    vt::is_version_first_bit_set.Set(pkg, (val & 1) != 0);
+})->Apply(BatchSizes);
+BENCHMARK_CAPTURE(SetBench, proxy_static_bool_field,
+                  [](Packet& pkg, const std::uint32_t val) noexcept {
+                      vt::static_is_version_first_bit_set.Set(pkg, (val & 1) != 0);
+                  })
+    ->Apply(BatchSizes);
+
+// Batch extraction of a column.
+BENCHMARK_CAPTURE(ExtractColumnBench, raw_swapped,
+                  [](const std::span<const Packet> pkgs,
+                     const std::span<std::uint32_t> vals) noexcept {
+                      std::ranges::transform(pkgs, vals.begin(), [](const Packet& pkg) noexcept {
+                          return std::byteswap(pkg.swapped_count);
+                      });
+                  })
+    ->Apply(BatchSizes);
+BENCHMARK_CAPTURE(ExtractColumnBench, proxy_swapped,
+                  [](const std::span<const Packet> pkgs,
+                     const std::span<std::uint32_t> vals) noexcept {
+                      ExtractColumn(vt::swapped_count, pkgs, vals);
+                  })
+    ->Apply(BatchSizes);
+
+// Flexible array fields.
+BENCHMARK_CAPTURE(FlexibleGetBench, raw, [](const Packet& pkg) noexcept {
+    return std::accumulate(pkg.first_item, pkg.first_item + pkg.native_count, std::uint64_t {0});
+})->Apply(ItemCounts);
+BENCHMARK_CAPTURE(FlexibleGetBench, proxy_view, [](const Packet& pkg) noexcept {
+    const auto items {vt::items.View(pkg)};
+    return std::accumulate(items.begin(), items.end(), std::uint64_t {0});
+})->Apply(ItemCounts);
+BENCHMARK_CAPTURE(FlexibleGetBench, proxy_get_all, [](const Packet& pkg) {
+    const auto items {vt::items.GetAll(pkg)};
+    return std::accumulate(items.begin(), items.end(), std::uint64_t {0});
+})->Apply(ItemCounts);
+
+BENCHMARK_CAPTURE(FlexibleSetBench, raw,
+                  [](Packet& pkg, const std::span<const std::uint32_t> vals) noexcept {
+                      std::memcpy(pkg.first_item, vals.data(), vals.size_bytes());
+                      pkg.native_count = static_cast<std::uint32_t>(vals.size());
+                  })
+    ->Apply(ItemCounts);
+BENCHMARK_CAPTURE(FlexibleSetBench, proxy,
+                  [](Packet& pkg, const std::span<const std::uint32_t> vals) noexcept {
+                      vt::items.SetAll(pkg, vals);
+                  })
+    ->Apply(ItemCounts);
+
+// Formatting.
+BENCHMARK_CAPTURE(FormatBench, raw, [](std::string& buffer, const Packet& pkg) {
+    std::format_to(std::back_inserter(buffer), "{}: {}", "The version", pkg.major_minor_version);
+});
+BENCHMARK_CAPTURE(FormatBench, proxy_format, [](std::string& buffer, const Packet& pkg) {
+    buffer = vt::version.Format(pkg);
+});
+BENCHMARK_CAPTURE(FormatBench, proxy_format_to, [](std::string& buffer, const Packet& pkg) {
+    vt::version.FormatTo(std::back_inserter(buffer), pkg);
+});
+
+BENCHMARK_CAPTURE(PrintBench, raw, [](std::ostream& os, std::string& buffer, const Packet& pkg) {
+    buffer.clear();
+    const auto major_version {static_cast<std::uint8_t>(pkg.major_minor_version >> CHAR_BIT)};
+    std::format_to(std::back_inserter(buffer), "{}: {}\n{}: {}\n{}: {}\n", "The version",
+                   pkg.major_minor_version, "The number of items", pkg.native_count,
+                   "The major version", major_version);
+    os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+});
+BENCHMARK_CAPTURE(PrintBench, proxy, [](std::ostream& os, std::string&, const Packet& pkg) {
+    PrintFields(os, pkg, std::tuple {vt::version, vt::native_count, vt::major_version});
+});
+BENCHMARK_CAPTURE(PrintBench, proxy_buffer,
+                  [](std::ostream& os, std::string& buffer, const Packet& pkg) {
+                      PrintFields(os, pkg, std::tuple {vt::version, vt::native_count,
+                                                       vt::major_version},
+                                  buffer);
+                  });
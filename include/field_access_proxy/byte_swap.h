@@ -0,0 +1,167 @@
+/**
+ * @file byte_swap.h
+ * @brief Bulk byte swapping of integral columns.
+ *
+ * @details
+ * On x86-64 with GCC or Clang, byte shuffling kernels for SSSE3 and AVX2 are selected at runtime.
+ * Otherwise, or if @p FIELD_ACCESS_PROXY_DISABLE_SIMD is defined, a scalar loop is used.
+ *
+ * @par GitHub
+ * https://github.com/Zhuagenborn
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if !defined(FIELD_ACCESS_PROXY_DISABLE_SIMD) && defined(__x86_64__) \
+    && (defined(__GNUC__) || defined(__clang__))
+    #define FIELD_ACCESS_PROXY_X86_SIMD
+    #include <immintrin.h>
+#endif
+
+namespace field_access_proxy {
+
+namespace impl {
+
+//! The instruction set extensions used for bulk byte swapping, from the least to the most capable.
+enum class SimdLevel { Scalar, Ssse3, Avx2 };
+
+#ifdef FIELD_ACCESS_PROXY_X86_SIMD
+
+//! Detect the best instruction set extensions supported by the running processor.
+inline SimdLevel GetSimdLevel() noexcept {
+    static const SimdLevel level {[] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return SimdLevel::Avx2;
+        } else if (__builtin_cpu_supports("ssse3")) {
+            return SimdLevel::Ssse3;
+        } else {
+            return SimdLevel::Scalar;
+        }
+    }()};
+    return level;
+}
+
+/**
+ * @brief Make a byte shuffling mask that reverses the bytes of each value in two 128-bit lanes.
+ *
+ * @tparam Size The size of a value in bytes.
+ */
+template <std::size_t Size>
+constexpr std::array<std::int8_t, 32> MakeByteSwapMask() noexcept {
+    constexpr std::size_t lane_size {16};
+    std::array<std::int8_t, 32> mask {};
+    for (std::size_t i {0}; i != mask.size(); ++i) {
+        const auto lane_pos {i % lane_size};
+        const auto val_begin {lane_pos - lane_pos % Size};
+        mask[i] = static_cast<std::int8_t>(val_begin + Size - 1 - lane_pos % Size);
+    }
+
+    return mask;
+}
+
+/**
+ * @brief Swap the bytes of values with SSSE3 until fewer than 16 bytes are left.
+ *
+ * @return The number of swapped values.
+ */
+template <std::size_t Size>
+__attribute__((target("ssse3"))) inline std::size_t ByteSwapSsse3(
+    std::uint8_t* const data, const std::size_t count) noexcept {
+    static constexpr auto mask_bytes {MakeByteSwapMask<Size>()};
+    const auto mask {_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask_bytes.data()))};
+    const auto byte_count {count * Size};
+    std::size_t i {0};
+    for (; i + sizeof(__m128i) <= byte_count; i += sizeof(__m128i)) {
+        const auto addr {reinterpret_cast<__m128i*>(data + i)};
+        _mm_storeu_si128(addr, _mm_shuffle_epi8(_mm_loadu_si128(addr), mask));
+    }
+
+    return i / Size;
+}
+
+/**
+ * @brief Swap the bytes of values with AVX2 until fewer than 32 bytes are left.
+ *
+ * @return The number of swapped values.
+ */
+template <std::size_t Size>
+__attribute__((target("avx2"))) inline std::size_t ByteSwapAvx2(std::uint8_t* const data,
+                                                                const std::size_t count) noexcept {
+    static constexpr auto mask_bytes {MakeByteSwapMask<Size>()};
+    const auto mask {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask_bytes.data()))};
+    const auto byte_count {count * Size};
+    std::size_t i {0};
+    for (; i + sizeof(__m256i) <= byte_count; i += sizeof(__m256i)) {
+        const auto addr {reinterpret_cast<__m256i*>(data + i)};
+        _mm256_storeu_si256(addr, _mm256_shuffle_epi8(_mm256_loadu_si256(addr), mask));
+    }
+
+    return i / Size;
+}
+
+#else
+
+//! Byte shuffling kernels are unavailable, so values are always swapped one by one.
+constexpr SimdLevel GetSimdLevel() noexcept {
+    return SimdLevel::Scalar;
+}
+
+#endif
+
+/**
+ * @brief Swap the bytes of every integral value in a contiguous column in place with specified instruction set extensions.
+ *
+ * @param vals Values.
+ * @param level Instruction set extensions, which must be supported by the running processor.
+ */
+template <std::integral T>
+void ByteSwapColumnWith(const std::span<T> vals, [[maybe_unused]] const SimdLevel level) noexcept {
+    assert(level <= GetSimdLevel());
+    if constexpr (sizeof(T) > 1) {
+        std::size_t swapped {0};
+#ifdef FIELD_ACCESS_PROXY_X86_SIMD
+        const auto data {reinterpret_cast<std::uint8_t*>(vals.data())};
+        switch (level) {
+            case SimdLevel::Avx2: {
+                swapped = ByteSwapAvx2<sizeof(T)>(data, vals.size());
+                break;
+            }
+            case SimdLevel::Ssse3: {
+                swapped = ByteSwapSsse3<sizeof(T)>(data, vals.size());
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+#endif
+        for (auto& val : vals.subspan(swapped)) {
+            val = std::byteswap(val);
+        }
+    }
+}
+
+}  // namespace impl
+
+/**
+ * @brief Swap the bytes of every integral value in a contiguous column in place.
+ *
+ * @details
+ * The best available instruction set extensions are selected at runtime,
+ * and remaining values are swapped one by one.
+ */
+template <std::integral T>
+void ByteSwapColumn(const std::span<T> vals) noexcept {
+    impl::ByteSwapColumnWith(vals, impl::GetSimdLevel());
+}
+
+}  // namespace field_access_proxy
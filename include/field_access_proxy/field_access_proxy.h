@@ -20,13 +20,25 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
 #include <climits>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <format>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -36,8 +48,37 @@
 
 #include <bit_manip/bit_manip.h>
 
+#include "byte_swap.h"
+
 namespace field_access_proxy {
 
+/**
+ * @brief A non-owning name of a proxy.
+ *
+ * @details
+ * The name is not copied, so it must outlive the proxy. String literals always do.
+ * Temporary strings are rejected at compile time, since they would be destroyed before the proxy.
+ * A @p std::string lvalue is accepted but only referenced,
+ * so it must not be destroyed or modified while the proxy is used.
+ */
+class NameView {
+public:
+    constexpr NameView(const char* const name) noexcept : name_ {name} {}
+
+    constexpr NameView(const std::string_view name) noexcept : name_ {name} {}
+
+    constexpr NameView(const std::string& name) noexcept : name_ {name} {}
+
+    NameView(std::string&&) = delete;
+
+    constexpr operator std::string_view() const noexcept {
+        return name_;
+    }
+
+private:
+    std::string_view name_;
+};
+
 namespace impl {
 
 //! Whether a type can be formatted using @p std::formatter.
@@ -51,7 +92,7 @@ concept IsFormattable = requires(
 //! A mixin class that provides a name to derived classes.
 class Named {
 public:
-    explicit constexpr Named(std::string name) noexcept : name_ {std::move(name)} {
+    explicit constexpr Named(const NameView name) noexcept : name_ {name} {
         assert(!name_.empty());
     }
 
@@ -60,9 +101,191 @@ public:
     }
 
 private:
-    std::string name_;
+    std::string_view name_;
 };
 
+/**
+ * @brief A string literal that can be used as a non-type template parameter.
+ *
+ * @tparam N The length of the string including the null terminator.
+ */
+template <std::size_t N>
+struct FixedString {
+    constexpr FixedString(const char (&str)[N]) noexcept {
+        std::copy_n(str, N, chars);
+    }
+
+    constexpr std::string_view View() const noexcept {
+        return {chars, N - 1};
+    }
+
+    char chars[N] {};
+};
+
+//! The structure and field types of a pointer-to-member.
+template <typename T>
+struct MemberPointerTraits;
+
+template <typename Struct_, typename Value_>
+struct MemberPointerTraits<Value_ Struct_::*> {
+    using Struct = Struct_;
+    using Value = Value_;
+};
+
+//! A tag indicating that the endianness of a field is specified at runtime.
+struct DynamicEndian {};
+
+inline constexpr DynamicEndian dynamic_endian {};
+
+//! Whether the endianness of a field is specified at runtime.
+template <auto Endian>
+concept IsDynamicEndian = std::same_as<std::remove_cvref_t<decltype(Endian)>, DynamicEndian>;
+
+//! Whether the endianness of a field is known at compile time and is the native one.
+template <auto Endian>
+concept IsNativeEndian = !IsDynamicEndian<Endian> && (Endian == std::endian::native);
+
+//! Whether a value can be used as the endianness of a field.
+template <auto Endian>
+concept IsEndian = std::same_as<decltype(Endian), std::endian> || IsDynamicEndian<Endian>;
+
+//! The storage of an endianness known at compile time, which takes no space.
+template <auto Endian>
+struct EndianHolder {
+    constexpr std::endian Get() const noexcept {
+        return Endian;
+    }
+};
+
+//! The storage of an endianness specified at runtime.
+template <>
+struct EndianHolder<dynamic_endian> {
+    constexpr std::endian Get() const noexcept {
+        return endian;
+    }
+
+    std::endian endian {std::endian::native};
+};
+
+//! Convert an integral value between the native endianness and an endianness known at compile time.
+template <std::endian Endian, std::integral T>
+constexpr T ConvertEndian(const T val) noexcept {
+    if constexpr (Endian == std::endian::native) {
+        return val;
+    } else {
+        return std::byteswap(val);
+    }
+}
+
+//! Convert an integral value between the native endianness and an endianness specified at runtime.
+template <std::integral T>
+constexpr T ConvertEndian(const T val, const std::endian endian) noexcept {
+    return endian == std::endian::native ? val : std::byteswap(val);
+}
+
+//! Whether objects of a type can be implicitly created in a byte array without being constructed.
+template <typename T>
+concept IsImplicitLifetime =
+    std::is_trivially_destructible_v<T>
+    && (std::is_aggregate_v<T> || std::is_trivially_default_constructible_v<T>
+        || std::is_trivially_copy_constructible_v<T> || std::is_trivially_move_constructible_v<T>);
+
+/**
+ * @brief Get the offset in bytes of a field within a structure.
+ *
+ * @details
+ * The offset is computed from a pointer-to-member without constructing or reading an object.
+ * It is a constant expression if the pointer-to-member is,
+ * otherwise it takes constant time without relying on optimization.
+ */
+template <typename Struct, typename Value>
+    requires IsImplicitLifetime<Struct>
+constexpr std::size_t GetMemberOffset(Value Struct::* const member) noexcept {
+    if consteval {
+        union Storage {
+            constexpr Storage() noexcept : bytes {} {}
+
+            std::byte bytes[sizeof(Struct)];
+            Struct obj;
+        };
+
+        // Pointers cannot be reinterpreted in constant evaluation, so compare addresses instead.
+        const Storage storage;
+        const void* const addr {std::addressof(storage.obj.*member)};
+        for (std::size_t offset {0}; offset != sizeof(Struct); ++offset) {
+            if (static_cast<const void*>(storage.bytes + offset) == addr) {
+                return offset;
+            }
+        }
+
+        return sizeof(Struct);
+    } else {
+        // Beginning the lifetime of a byte array implicitly creates a structure in it,
+        // so the member can be addressed without reading the inactive member of a union.
+        alignas(Struct) std::byte storage[sizeof(Struct)] {};
+        const auto obj {std::launder(reinterpret_cast<const Struct*>(storage))};
+        const auto addr {reinterpret_cast<std::uintptr_t>(std::addressof(obj->*member))};
+        return static_cast<std::size_t>(addr - reinterpret_cast<std::uintptr_t>(storage));
+    }
+}
+
+//! Whether the field accessed by a field proxy can be identified by its pointer-to-member and endianness.
+template <typename FieldProxy>
+concept IsIdentifiableField = requires(const FieldProxy field) {
+    field.GetMember();
+    field.GetEndian();
+};
+
+/**
+ * @brief Check whether two field proxies access the same field.
+ *
+ * @details
+ * Proxies that are not @ref IsIdentifiableField are never considered the same.
+ */
+template <typename FieldProxy>
+constexpr bool IsSameField(const FieldProxy& lhs, const FieldProxy& rhs) noexcept {
+    if constexpr (IsIdentifiableField<FieldProxy>) {
+        return lhs.GetMember() == rhs.GetMember() && lhs.GetEndian() == rhs.GetEndian();
+    } else {
+        return false;
+    }
+}
+
+//! Whether a type can be loaded from and stored to raw bytes.
+template <typename T>
+concept IsByteCopyable = std::is_trivially_copyable_v<T> && !std::is_array_v<T>;
+
+//! Load a trivially copyable value from bytes that do not need to be aligned.
+template <IsByteCopyable T>
+T LoadBytes(const std::byte* const src) noexcept {
+    std::array<std::byte, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), src, sizeof(T));
+    return std::bit_cast<T>(bytes);
+}
+
+//! Store a trivially copyable value to bytes that do not need to be aligned.
+template <IsByteCopyable T>
+void StoreBytes(std::byte* const dest, const T& val) noexcept {
+    const auto bytes {std::bit_cast<std::array<std::byte, sizeof(T)>>(val)};
+    std::memcpy(dest, bytes.data(), sizeof(T));
+}
+
+//! An empty placeholder used when no custom formatter is provided.
+struct NoFormatter {
+    constexpr NoFormatter(std::nullptr_t) noexcept {}
+};
+
+//! The storage type of a formatter, which takes no space when no custom formatter is provided.
+template <typename Formatter>
+using FormatterStorage =
+    std::conditional_t<std::same_as<std::decay_t<Formatter>, std::nullptr_t>, NoFormatter,
+                       Formatter>;
+
+//! Whether a custom formatter writes a field to an output iterator instead of returning a string.
+template <typename Formatter, typename OutputIt, typename Struct, typename RawField>
+concept IsFormatterTo = std::invocable<const FormatterStorage<Formatter>&, OutputIt, const Struct&,
+                                       const RawField&>;
+
 /**
  * @brief A mixin class that enables formatting of a field within a structure.
  *
@@ -70,6 +293,9 @@ private:
  * This class supports custom or default formatting of a field extracted via an adapter,
  * and optionally applies a user-defined formatter.
  *
+ * A custom formatter can either return a string as @p formatter(obj, val),
+ * or write to an output iterator and return the iterator past the end as @p formatter(out, obj, val).
+ *
  * @tparam Struct The type of the structure containing the field.
  * @tparam FieldProxy The field proxy (e.g., @p Field) that provides access to its value and name.
  * @tparam RawField The raw type of the field to be formatted (e.g., @p int).
@@ -93,13 +319,39 @@ public:
      * the method triggers an assertion failure and reaches an unreachable state.
      */
     std::string Format(const Struct& obj) const {
+        using OutputIt = std::back_insert_iterator<std::string>;
+        if constexpr (HasCustomFormatter()
+                      && !IsFormatterTo<Formatter, OutputIt, Struct, RawField>) {
+            const auto& field {static_cast<const FieldProxy&>(*this)};
+            return formatter_(obj, field.Get(obj));
+        } else {
+            std::string str;
+            FormatTo(std::back_inserter(str), obj);
+            return str;
+        }
+    }
+
+    /**
+     * @brief Format the value of a field within a structure to an output iterator.
+     *
+     * @details
+     * It is the same as @ref Format, but writes to a caller-supplied output iterator,
+     * so no string is allocated unless the custom formatter returns one.
+     *
+     * @return The iterator past the end of the formatted field.
+     */
+    template <std::output_iterator<char> OutputIt>
+    OutputIt FormatTo(OutputIt out, const Struct& obj) const {
         const auto& field {static_cast<const FieldProxy&>(*this)};
         const auto& val {field.Get(obj)};
-        if constexpr (!std::same_as<std::decay_t<Formatter>, std::nullptr_t>) {
-            return formatter_(obj, val);
+        if constexpr (IsFormatterTo<Formatter, OutputIt, Struct, RawField>) {
+            return formatter_(std::move(out), obj, val);
+        } else if constexpr (HasCustomFormatter()) {
+            const auto& str {formatter_(obj, val)};
+            return std::ranges::copy(std::string_view {str}, std::move(out)).out;
         } else {
             if constexpr (IsFormattable<RawField>) {
-                return std::format("{}: {}", field.GetName(), val);
+                return std::format_to(std::move(out), "{}: {}", field.GetName(), val);
             } else {
                 assert(false);
                 std::unreachable();
@@ -108,9 +360,300 @@ public:
     }
 
 private:
-    Formatter formatter_;
+    static constexpr bool HasCustomFormatter() noexcept {
+        return !std::same_as<std::decay_t<Formatter>, std::nullptr_t>;
+    }
+
+    [[no_unique_address]] FormatterStorage<Formatter> formatter_;
+};
+
+//! The number of values processed at once by batch operations that need a temporary buffer.
+inline constexpr std::size_t column_chunk_size {256};
+
+/**
+ * @brief Get the values of a field from an array of objects.
+ *
+ * @details
+ * If the field proxy provides a batch method @p GetColumn, it is used.
+ * Otherwise, the values are read one by one.
+ */
+template <typename FieldProxy, typename Struct, typename Value>
+void GetColumn(const FieldProxy& field, const std::span<const Struct> objs,
+               const std::span<Value> vals) noexcept {
+    assert(vals.size() >= objs.size());
+    if constexpr (requires { field.GetColumn(objs, vals); }) {
+        field.GetColumn(objs, vals);
+    } else {
+        for (std::size_t i {0}; i != objs.size(); ++i) {
+            vals[i] = field.Get(objs[i]);
+        }
+    }
+}
+
+/**
+ * @brief Set the values of a field for an array of objects.
+ *
+ * @details
+ * If the field proxy provides a batch method @p SetColumn, it is used.
+ * Otherwise, the values are written one by one.
+ */
+template <typename FieldProxy, typename Value, typename Struct>
+void SetColumn(const FieldProxy& field, const std::span<const Value> vals,
+               const std::span<Struct> objs) noexcept {
+    assert(vals.size() >= objs.size());
+    if constexpr (requires { field.SetColumn(vals, objs); }) {
+        field.SetColumn(vals, objs);
+    } else {
+        for (std::size_t i {0}; i != objs.size(); ++i) {
+            field.Set(objs[i], vals[i]);
+        }
+    }
+}
+
+/**
+ * @brief Get the values of a field with a pointer-to-member from an array of objects.
+ *
+ * @details
+ * Raw values are gathered first, and then byte swapped in bulk if the endianness is not native.
+ */
+template <typename FieldProxy>
+void GetMemberColumn(const FieldProxy& field,
+                     const std::span<const typename FieldProxy::Struct> objs,
+                     const std::span<typename FieldProxy::Value> vals) noexcept {
+    assert(vals.size() >= objs.size());
+    const auto member {field.GetMember()};
+    for (std::size_t i {0}; i != objs.size(); ++i) {
+        vals[i] = objs[i].*member;
+    }
+
+    if constexpr (std::integral<typename FieldProxy::Value>) {
+        if (field.GetEndian() != std::endian::native) {
+            ByteSwapColumn(vals.first(objs.size()));
+        }
+    }
+}
+
+/**
+ * @brief Set the values of a field with a pointer-to-member for an array of objects.
+ *
+ * @details
+ * If the endianness is not native, values are byte swapped in bulk in chunks before being scattered.
+ */
+template <typename FieldProxy>
+void SetMemberColumn(const FieldProxy& field,
+                     const std::span<const typename FieldProxy::Value> vals,
+                     const std::span<typename FieldProxy::Struct> objs) noexcept {
+    using Value = typename FieldProxy::Value;
+    assert(vals.size() >= objs.size());
+    const auto member {field.GetMember()};
+    if constexpr (std::integral<Value>) {
+        if (field.GetEndian() != std::endian::native) {
+            std::array<Value, column_chunk_size> swapped;
+            for (std::size_t begin {0}; begin < objs.size(); begin += swapped.size()) {
+                const auto count {std::min(swapped.size(), objs.size() - begin)};
+                std::ranges::copy(vals.subspan(begin, count), swapped.begin());
+                ByteSwapColumn(std::span {swapped}.first(count));
+                for (std::size_t i {0}; i != count; ++i) {
+                    objs[begin + i].*member = swapped[i];
+                }
+            }
+
+            return;
+        }
+    }
+
+    for (std::size_t i {0}; i != objs.size(); ++i) {
+        objs[i].*member = vals[i];
+    }
+}
+
+/**
+ * @brief Get the values of a bit field from an array of objects.
+ *
+ * @details
+ * The parent fields are read in chunks first, and then the bits are extracted in bulk.
+ */
+template <typename BitFieldProxy>
+void GetBitColumn(const BitFieldProxy& field,
+                  const std::span<const typename BitFieldProxy::Struct> objs,
+                  const std::span<typename BitFieldProxy::Value> vals) noexcept {
+    using Parent = typename std::remove_cvref_t<decltype(field.GetParent())>::Value;
+    assert(vals.size() >= objs.size());
+    std::array<Parent, column_chunk_size> fields;
+    for (std::size_t begin {0}; begin < objs.size(); begin += fields.size()) {
+        const auto count {std::min(fields.size(), objs.size() - begin)};
+        GetColumn(field.GetParent(), objs.subspan(begin, count), std::span {fields}.first(count));
+        for (std::size_t i {0}; i != count; ++i) {
+            vals[begin + i] = field.Extract(fields[i]);
+        }
+    }
+}
+
+/**
+ * @brief Set the values of a bit field for an array of objects.
+ *
+ * @details
+ * The parent fields are read in chunks first, then the bits are merged in bulk and written back.
+ */
+template <typename BitFieldProxy>
+void SetBitColumn(const BitFieldProxy& field,
+                  const std::span<const typename BitFieldProxy::Value> vals,
+                  const std::span<typename BitFieldProxy::Struct> objs) noexcept {
+    using Struct = typename BitFieldProxy::Struct;
+    using Parent = typename std::remove_cvref_t<decltype(field.GetParent())>::Value;
+    assert(vals.size() >= objs.size());
+    std::array<Parent, column_chunk_size> fields;
+    for (std::size_t begin {0}; begin < objs.size(); begin += fields.size()) {
+        const auto count {std::min(fields.size(), objs.size() - begin)};
+        const auto chunk {objs.subspan(begin, count)};
+        const auto chunk_fields {std::span {fields}.first(count)};
+        GetColumn(field.GetParent(), std::span<const Struct> {chunk}, chunk_fields);
+        for (std::size_t i {0}; i != count; ++i) {
+            chunk_fields[i] = field.Insert(chunk_fields[i], vals[begin + i]);
+        }
+
+        SetColumn(field.GetParent(), std::span<const Parent> {chunk_fields}, chunk);
+    }
+}
+
+/**
+ * @brief An output iterator that writes characters to a fixed-size buffer.
+ *
+ * @details
+ * Characters that do not fit into the buffer are discarded but still counted.
+ */
+class TruncatingIterator {
+public:
+    using difference_type = std::ptrdiff_t;
+
+    constexpr TruncatingIterator() noexcept = default;
+
+    explicit constexpr TruncatingIterator(const std::span<char> buffer) noexcept :
+        buffer_ {buffer} {}
+
+    constexpr TruncatingIterator& operator*() noexcept {
+        return *this;
+    }
+
+    constexpr TruncatingIterator& operator=(const char c) noexcept {
+        if (count_ < buffer_.size()) [[likely]] {
+            buffer_[count_] = c;
+        }
+
+        ++count_;
+        return *this;
+    }
+
+    constexpr TruncatingIterator& operator++() noexcept {
+        return *this;
+    }
+
+    constexpr TruncatingIterator& operator++(int) noexcept {
+        return *this;
+    }
+
+    //! Get the number of characters written, including discarded ones.
+    constexpr std::size_t GetCount() const noexcept {
+        return count_;
+    }
+
+private:
+    std::span<char> buffer_;
+    std::size_t count_ {0};
+};
+
+//! Whether a field proxy provides a view of elements stored after the structure (e.g., @p FlexibleArrayField).
+template <typename FieldProxy>
+concept HasElementView = requires(const FieldProxy field, const typename FieldProxy::Struct obj) {
+    field.View(obj);
+};
+
+/**
+ * @brief A fast non-cryptographic hasher that consumes 64-bit words.
+ *
+ * @details
+ * Each word is multiplied and rotated into the state, and the state is avalanched when finished.
+ * Bytes are consumed in words, so contiguous memory is hashed without per-byte work.
+ */
+class Hasher {
+public:
+    constexpr Hasher& Update(const std::uint64_t word) noexcept {
+        state_ = std::rotl(state_ ^ (word * mul_1), 31) * mul_2;
+        return *this;
+    }
+
+    Hasher& Update(const std::span<const std::byte> bytes) noexcept {
+        constexpr auto word_size {sizeof(std::uint64_t)};
+        std::size_t i {0};
+        for (; i + word_size <= bytes.size(); i += word_size) {
+            Update(LoadBytes<std::uint64_t>(bytes.data() + i));
+        }
+
+        std::uint64_t tail {0};
+        if (i != bytes.size()) {
+            // An empty span may have a null pointer, which cannot be passed to `std::memcpy`.
+            std::memcpy(&tail, bytes.data() + i, bytes.size() - i);
+        }
+
+        // The length is mixed into the last word, so byte ranges padded with zeros do not collide.
+        return Update(tail ^ (static_cast<std::uint64_t>(bytes.size()) << 56));
+    }
+
+    constexpr std::uint64_t Finish() const noexcept {
+        auto hash {state_};
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCD;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+private:
+    static constexpr std::uint64_t mul_1 {0x9E3779B97F4A7C15};
+    static constexpr std::uint64_t mul_2 {0xBF58476D1CE4E5B9};
+
+    std::uint64_t state_ {0};
 };
 
+//! Whether a field proxy refers to a member whose raw bytes fully represent its value.
+template <typename FieldProxy>
+concept HasHashableMember = requires(const FieldProxy field) {
+    { field.GetMember() } -> std::same_as<typename FieldProxy::Value FieldProxy::Struct::*>;
+} && std::has_unique_object_representations_v<typename FieldProxy::Value>;
+
+//! Hash a value by its integral value, its bytes if they fully represent it, or @p std::hash.
+template <typename Value>
+void HashValue(Hasher& hasher, const Value& val) noexcept {
+    if constexpr (std::integral<Value> || std::is_enum_v<Value>) {
+        hasher.Update(static_cast<std::uint64_t>(val));
+    } else if constexpr (std::has_unique_object_representations_v<Value>) {
+        hasher.Update(std::as_bytes(std::span {std::addressof(val), 1}));
+    } else {
+        hasher.Update(static_cast<std::uint64_t>(std::hash<Value> {}(val)));
+    }
+}
+
+//! Hash the value of a field within an object.
+template <typename FieldProxy, typename Struct>
+void HashField(Hasher& hasher, const FieldProxy& field, const Struct& obj) noexcept {
+    if constexpr (HasElementView<FieldProxy>) {
+        hasher.Update(std::as_bytes(field.View(obj)));
+    } else {
+        HashValue(hasher, field.Get(obj));
+    }
+}
+
+//! Compare the raw values of a field within two objects without formatting them.
+template <typename FieldProxy, typename Struct>
+bool FieldEquals(const FieldProxy& field, const Struct& lhs, const Struct& rhs) noexcept {
+    if constexpr (HasElementView<FieldProxy>) {
+        return std::ranges::equal(field.View(lhs), field.View(rhs));
+    } else {
+        return field.Get(lhs) == field.Get(rhs);
+    }
+}
+
 }  // namespace impl
 
 /**
@@ -119,15 +662,26 @@ private:
  * @tparam Struct_ The structure type.
  * @tparam RawField The raw field type (e.g., @p std::uint32_t).
  * @tparam Formatter An optional callable for custom formatting.
+ * @tparam Endian
+ * The endianness of the field.
+ * It is specified at runtime by default, or can be a @p std::endian value known at compile time,
+ * in which case byte swapping is chosen at compile time and no endianness is stored.
  */
-template <typename Struct_, typename RawField, typename Formatter = std::nullptr_t>
+template <typename Struct_, typename RawField, typename Formatter = std::nullptr_t,
+          auto Endian = impl::dynamic_endian>
+    requires impl::IsEndian<Endian>
 class Field :
     public impl::Named,
-    public impl::Formattable<Struct_, Field<Struct_, RawField, Formatter>, RawField, Formatter> {
+    public impl::Formattable<Struct_, Field<Struct_, RawField, Formatter, Endian>, RawField,
+                             Formatter> {
 public:
     using Struct = Struct_;
     using Value = RawField;
 
+    static_assert(impl::IsDynamicEndian<Endian> || impl::IsNativeEndian<Endian>
+                      || std::integral<Value>,
+                  "Only integral fields can have a non-native endianness");
+
     /**
      * @brief Create a new field proxy.
      *
@@ -135,11 +689,10 @@ public:
      * @param field A pointer-to-member specifying the field within the structure.
      * @param formatter An optional formatter used for field formatting.
      */
-    explicit constexpr Field(std::string name, Value Struct::* const field,
+    explicit constexpr Field(const NameView name, Value Struct::* const field,
                              Formatter&& formatter = nullptr) noexcept :
-        Named {std::move(name)},
-        impl::Formattable<Struct, Field<Struct, Value, Formatter>, Value, Formatter> {
-            std::forward<Formatter>(formatter)},
+        Named {name},
+        impl::Formattable<Struct, Field, Value, Formatter> {std::forward<Formatter>(formatter)},
         field_ {field} {
         assert(field_ != nullptr);
     }
@@ -152,42 +705,234 @@ public:
      * @param endian The endianness of the field.
      * @param formatter An optional formatter used for field formatting.
      */
-    explicit constexpr Field(std::string name, Value Struct::* const field,
+    explicit constexpr Field(const NameView name, Value Struct::* const field,
                              const std::endian endian, Formatter&& formatter = nullptr) noexcept
-        requires std::integral<Value>
+        requires std::integral<Value> && impl::IsDynamicEndian<Endian>
         :
-        Named {std::move(name)},
-        impl::Formattable<Struct, Field<Struct, Value, Formatter>, Value, Formatter> {
-            std::forward<Formatter>(formatter)},
-        field_ {field},
-        endian_ {endian} {
+        Named {name},
+        impl::Formattable<Struct, Field, Value, Formatter> {std::forward<Formatter>(formatter)},
+        endian_ {endian},
+        field_ {field} {
         assert(field_ != nullptr);
     }
 
+    //! Get the endianness of the field.
+    constexpr std::endian GetEndian() const noexcept {
+        return endian_.Get();
+    }
+
+    //! Get the pointer-to-member representing the field within the structure.
+    constexpr Value Struct::* GetMember() const noexcept {
+        return field_;
+    }
+
     //! Get the value of the field from an object.
     auto Get(const Struct& obj) const noexcept {
-        if constexpr (std::integral<Value>) {
-            return endian_ == std::endian::native ? obj.*field_ : std::byteswap(obj.*field_);
-        } else {
+        if constexpr (!std::integral<Value>) {
             return static_cast<const Value&>(obj.*field_);
+        } else if constexpr (impl::IsDynamicEndian<Endian>) {
+            return impl::ConvertEndian(obj.*field_, GetEndian());
+        } else {
+            return impl::ConvertEndian<Endian>(obj.*field_);
         }
     }
 
     //! Set the field to a new value for an object.
     const Field& Set(Struct& obj, Value val) const noexcept {
+        if constexpr (!std::integral<Value>) {
+            obj.*field_ = std::move(val);
+        } else if constexpr (impl::IsDynamicEndian<Endian>) {
+            obj.*field_ = impl::ConvertEndian(val, GetEndian());
+        } else {
+            obj.*field_ = impl::ConvertEndian<Endian>(val);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Get the value of the field from the bytes of an object.
+     *
+     * @details
+     * The bytes do not need to be aligned, and no object is accessed through @p reinterpret_cast.
+     */
+    auto Get(const std::span<const std::byte> bytes) const noexcept
+        requires impl::IsByteCopyable<Value>
+    {
+        const auto offset {impl::GetMemberOffset(field_)};
+        assert(offset + sizeof(Value) <= bytes.size());
+        const auto val {impl::LoadBytes<Value>(bytes.data() + offset)};
         if constexpr (std::integral<Value>) {
-            obj.*field_ = endian_ == std::endian::native ? std::move(val) : std::byteswap(val);
+            return impl::ConvertEndian(val, GetEndian());
         } else {
-            obj.*field_ = std::move(val);
+            return val;
+        }
+    }
+
+    //! Set the field to a new value in the bytes of an object.
+    const Field& Set(const std::span<std::byte> bytes, const Value val) const noexcept
+        requires impl::IsByteCopyable<Value>
+    {
+        const auto offset {impl::GetMemberOffset(field_)};
+        assert(offset + sizeof(Value) <= bytes.size());
+        if constexpr (std::integral<Value>) {
+            impl::StoreBytes(bytes.data() + offset, impl::ConvertEndian(val, GetEndian()));
+        } else {
+            impl::StoreBytes(bytes.data() + offset, val);
         }
+
         return *this;
     }
 
+    /**
+     * @brief Get the values of the field from an array of objects.
+     *
+     * @details
+     * Raw values are gathered first, and then byte swapped in bulk if the endianness is not native.
+     */
+    void GetColumn(const std::span<const Struct> objs, const std::span<Value> vals) const noexcept {
+        impl::GetMemberColumn(*this, objs, vals);
+    }
+
+    /**
+     * @brief Set the values of the field for an array of objects.
+     *
+     * @details
+     * If the endianness is not native, values are byte swapped in bulk in chunks before being scattered.
+     */
+    void SetColumn(const std::span<const Value> vals, const std::span<Struct> objs) const noexcept {
+        impl::SetMemberColumn(*this, vals, objs);
+    }
+
 private:
-    std::endian endian_ {std::endian::native};
+    [[no_unique_address]] impl::EndianHolder<Endian> endian_ {};
     Value Struct::* field_;
 };
 
+/**
+ * @brief A regular field proxy whose member, name and endianness are all known at compile time.
+ *
+ * @details
+ * Unlike @p Field, this proxy stores nothing but an optional custom formatter,
+ * so accessing a field compiles down to a plain load or store.
+ *
+ * @tparam Member A pointer-to-member specifying the field within the structure.
+ * @tparam Name The field name.
+ * @tparam Endian The endianness of the field, only integral fields can be non-native.
+ * @tparam Formatter An optional callable for custom formatting.
+ */
+template <auto Member, impl::FixedString Name, std::endian Endian = std::endian::native,
+          typename Formatter = std::nullptr_t>
+    requires std::is_member_object_pointer_v<decltype(Member)>
+class StaticField :
+    public impl::Formattable<typename impl::MemberPointerTraits<decltype(Member)>::Struct,
+                             StaticField<Member, Name, Endian, Formatter>,
+                             typename impl::MemberPointerTraits<decltype(Member)>::Value,
+                             Formatter> {
+public:
+    using Struct = typename impl::MemberPointerTraits<decltype(Member)>::Struct;
+    using Value = typename impl::MemberPointerTraits<decltype(Member)>::Value;
+
+    static_assert(Member != nullptr);
+    static_assert(Endian == std::endian::native || std::integral<Value>,
+                  "Only integral fields can have a non-native endianness");
+
+    /**
+     * @brief Create a new field proxy.
+     *
+     * @param formatter An optional formatter used for field formatting.
+     */
+    explicit constexpr StaticField(Formatter&& formatter = nullptr) noexcept :
+        impl::Formattable<Struct, StaticField, Value, Formatter> {
+            std::forward<Formatter>(formatter)} {}
+
+    static constexpr std::string_view GetName() noexcept {
+        return Name.View();
+    }
+
+    //! Get the endianness of the field.
+    static constexpr std::endian GetEndian() noexcept {
+        return Endian;
+    }
+
+    //! Get the pointer-to-member representing the field within the structure.
+    static constexpr auto GetMember() noexcept {
+        return Member;
+    }
+
+    //! Get the value of the field from an object.
+    constexpr auto Get(const Struct& obj) const noexcept {
+        if constexpr (std::integral<Value>) {
+            return impl::ConvertEndian<Endian>(obj.*Member);
+        } else {
+            return static_cast<const Value&>(obj.*Member);
+        }
+    }
+
+    //! Set the field to a new value for an object.
+    constexpr const StaticField& Set(Struct& obj, Value val) const noexcept {
+        if constexpr (std::integral<Value>) {
+            obj.*Member = impl::ConvertEndian<Endian>(val);
+        } else {
+            obj.*Member = std::move(val);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Get the value of the field from the bytes of an object.
+     *
+     * @details
+     * The bytes do not need to be aligned, and no object is accessed through @p reinterpret_cast.
+     */
+    auto Get(const std::span<const std::byte> bytes) const noexcept
+        requires impl::IsByteCopyable<Value>
+    {
+        constexpr auto offset {impl::GetMemberOffset(Member)};
+        assert(offset + sizeof(Value) <= bytes.size());
+        const auto val {impl::LoadBytes<Value>(bytes.data() + offset)};
+        if constexpr (std::integral<Value>) {
+            return impl::ConvertEndian<Endian>(val);
+        } else {
+            return val;
+        }
+    }
+
+    //! Set the field to a new value in the bytes of an object.
+    const StaticField& Set(const std::span<std::byte> bytes, const Value val) const noexcept
+        requires impl::IsByteCopyable<Value>
+    {
+        constexpr auto offset {impl::GetMemberOffset(Member)};
+        assert(offset + sizeof(Value) <= bytes.size());
+        if constexpr (std::integral<Value>) {
+            impl::StoreBytes(bytes.data() + offset, impl::ConvertEndian<Endian>(val));
+        } else {
+            impl::StoreBytes(bytes.data() + offset, val);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Get the values of the field from an array of objects.
+     *
+     * @details
+     * Raw values are gathered first, and then byte swapped in bulk if the endianness is not native.
+     */
+    void GetColumn(const std::span<const Struct> objs, const std::span<Value> vals) const noexcept {
+        impl::GetMemberColumn(*this, objs, vals);
+    }
+
+    /**
+     * @brief Set the values of the field for an array of objects.
+     *
+     * @details
+     * If the endianness is not native, values are byte swapped in bulk in chunks before being scattered.
+     */
+    void SetColumn(const std::span<const Value> vals, const std::span<Struct> objs) const noexcept {
+        impl::SetMemberColumn(*this, vals, objs);
+    }
+};
+
 /**
  * @brief A bit field proxy within a parent integral field of a structure.
  *
@@ -215,12 +960,12 @@ public:
      * @param bit_width The width of the bit field in bits.
      * @param formatter An optional formatter used for field formatting.
      */
-    explicit constexpr BitField(std::string name, ParentFieldProxy parent,
+    explicit constexpr BitField(const NameView name, ParentFieldProxy parent,
                                 const std::size_t bit_offset, const std::size_t bit_width,
                                 Formatter&& formatter = nullptr) noexcept
         requires(!std::same_as<Value, bool>)
         :
-        Named {std::move(name)},
+        Named {name},
         impl::Formattable<Struct, BitField<ParentFieldProxy, Value, Formatter>, Value, Formatter> {
             std::forward<Formatter>(formatter)},
         parent_ {std::move(parent)},
@@ -235,11 +980,11 @@ public:
      * @param bit_pos The offset in bits from the least significant bit of the parent field.
      * @param formatter An optional formatter used for field formatting.
      */
-    explicit constexpr BitField(std::string name, ParentFieldProxy parent,
+    explicit constexpr BitField(const NameView name, ParentFieldProxy parent,
                                 const std::size_t bit_pos, Formatter&& formatter = nullptr) noexcept
         requires std::same_as<Value, bool>
         :
-        Named {std::move(name)},
+        Named {name},
         impl::Formattable<Struct, BitField<ParentFieldProxy, Value, Formatter>, Value, Formatter> {
             std::forward<Formatter>(formatter)},
         parent_ {std::move(parent)},
@@ -248,7 +993,53 @@ public:
 
     //! Get the value of the field from an object.
     Value Get(const Struct& obj) const noexcept {
-        const auto field {parent_.Get(obj)};
+        return Extract(parent_.Get(obj));
+    }
+
+    //! Set the field to a new value for an object.
+    const BitField& Set(Struct& obj, const Value val) const noexcept {
+        parent_.Set(obj, Insert(parent_.Get(obj), val));
+        return *this;
+    }
+
+    //! Get the value of the field from the bytes of an object, which do not need to be aligned.
+    Value Get(const std::span<const std::byte> bytes) const noexcept {
+        return Extract(parent_.Get(bytes));
+    }
+
+    //! Set the field to a new value in the bytes of an object, which do not need to be aligned.
+    const BitField& Set(const std::span<std::byte> bytes, const Value val) const noexcept {
+        parent_.Set(bytes, Insert(parent_.Get(std::span<const std::byte> {bytes}), val));
+        return *this;
+    }
+
+    /**
+     * @brief Get the values of the field from an array of objects.
+     *
+     * @details
+     * The parent fields are read in chunks first, and then the bits are extracted in bulk.
+     */
+    void GetColumn(const std::span<const Struct> objs, const std::span<Value> vals) const noexcept {
+        impl::GetBitColumn(*this, objs, vals);
+    }
+
+    /**
+     * @brief Set the values of the field for an array of objects.
+     *
+     * @details
+     * The parent fields are read in chunks first, then the bits are merged in bulk and written back.
+     */
+    void SetColumn(const std::span<const Value> vals, const std::span<Struct> objs) const noexcept {
+        impl::SetBitColumn(*this, vals, objs);
+    }
+
+    //! Get the parent field proxy.
+    constexpr const ParentFieldProxy& GetParent() const noexcept {
+        return parent_;
+    }
+
+    //! Extract the value of the bit field from a value of its parent field.
+    constexpr Value Extract(const typename ParentFieldProxy::Value field) const noexcept {
         if constexpr (std::same_as<Value, bool>) {
             return bit::IsBitSet(field, bit_offset_);
         } else {
@@ -256,9 +1047,9 @@ public:
         }
     }
 
-    //! Set the field to a new value for an object.
-    const BitField& Set(Struct& obj, const Value val) const noexcept {
-        auto field {parent_.Get(obj)};
+    //! Insert a new value of the bit field into a value of its parent field.
+    constexpr typename ParentFieldProxy::Value Insert(typename ParentFieldProxy::Value field,
+                                                      const Value val) const noexcept {
         if constexpr (std::same_as<Value, bool>) {
             if (val) {
                 bit::SetBit(field, bit_offset_);
@@ -266,22 +1057,226 @@ public:
                 bit::ClearBit(field, bit_offset_);
             }
         } else {
-            bit::SetBits(field, static_cast<decltype(field)>(val), bit_offset_, bit_width_);
+            bit::SetBits(field, static_cast<Parent>(val), bit_offset_, bit_width_);
+        }
+
+        return field;
+    }
+
+private:
+    using Parent = typename ParentFieldProxy::Value;
+
+    ParentFieldProxy parent_;
+    std::size_t bit_offset_;
+    std::size_t bit_width_;
+};
+
+//! A boolean field proxy within a parent integral field of a structure.
+template <typename ParentFieldProxy, typename Formatter = std::nullptr_t>
+using BoolField = BitField<ParentFieldProxy, bool, Formatter>;
+
+/**
+ * @brief A bit field proxy within a parent integral field of a structure, whose offset and width are known at compile time.
+ *
+ * @details
+ * The shift and mask are constants, so accessing the bit field compiles down to a shift and a mask.
+ *
+ * @tparam ParentFieldProxy The parent field proxy (e.g., @p Field) to access the integral field that contains this bit field.
+ * @tparam Offset The offset in bits from the least significant bit of the parent field.
+ * @tparam Width The width of the bit field in bits.
+ * @tparam Target The type of the bit field (e.g., @p std::uint8_t).
+ * @tparam Formatter An optional callable for custom formatting.
+ */
+template <typename ParentFieldProxy, std::size_t Offset, std::size_t Width,
+          typename Target = typename ParentFieldProxy::Value, typename Formatter = std::nullptr_t>
+    requires std::integral<Target> || std::is_scoped_enum_v<Target>
+                 || std::same_as<Target, std::byte>
+class StaticBitField :
+    public impl::Named,
+    public impl::Formattable<typename ParentFieldProxy::Struct,
+                             StaticBitField<ParentFieldProxy, Offset, Width, Target, Formatter>,
+                             Target, Formatter> {
+public:
+    using Struct = typename ParentFieldProxy::Struct;
+    using Value = Target;
+
+private:
+    using Parent = typename ParentFieldProxy::Value;
+    using Bits = std::make_unsigned_t<Parent>;
+
+    static constexpr std::size_t parent_width {sizeof(Parent) * CHAR_BIT};
+
+    static_assert(Width > 0, "The bit field must not be empty");
+    static_assert(Offset + Width <= parent_width, "The bit field must fit inside its parent field");
+    static_assert(!std::same_as<Value, bool> || Width == 1,
+                  "A boolean field must be a single bit");
+
+    static constexpr Bits mask {Width == parent_width ? static_cast<Bits>(~Bits {0})
+                                                      : static_cast<Bits>((Bits {1} << Width) - 1)};
+    static constexpr Bits shifted_mask {static_cast<Bits>(mask << Offset)};
+
+public:
+    /**
+     * @brief Create a new bit field proxy.
+     *
+     * @param name The field name.
+     * @param parent The parent field proxy that provides access to the underlying integral field.
+     * @param formatter An optional formatter used for field formatting.
+     */
+    explicit constexpr StaticBitField(const NameView name, ParentFieldProxy parent,
+                                      Formatter&& formatter = nullptr) noexcept :
+        Named {name},
+        impl::Formattable<Struct, StaticBitField, Value, Formatter> {
+            std::forward<Formatter>(formatter)},
+        parent_ {std::move(parent)} {}
+
+    //! Get the value of the field from an object.
+    constexpr Value Get(const Struct& obj) const noexcept {
+        return Extract(parent_.Get(obj));
+    }
+
+    //! Set the field to a new value for an object.
+    constexpr const StaticBitField& Set(Struct& obj, const Value val) const noexcept {
+        parent_.Set(obj, Insert(parent_.Get(obj), val));
+        return *this;
+    }
+
+    //! Get the value of the field from the bytes of an object, which do not need to be aligned.
+    Value Get(const std::span<const std::byte> bytes) const noexcept {
+        return Extract(parent_.Get(bytes));
+    }
+
+    //! Set the field to a new value in the bytes of an object, which do not need to be aligned.
+    const StaticBitField& Set(const std::span<std::byte> bytes, const Value val) const noexcept {
+        parent_.Set(bytes, Insert(parent_.Get(std::span<const std::byte> {bytes}), val));
+        return *this;
+    }
+
+    /**
+     * @brief Get the values of the field from an array of objects.
+     *
+     * @details
+     * The parent fields are read in chunks first, and then the bits are extracted in bulk.
+     */
+    void GetColumn(const std::span<const Struct> objs, const std::span<Value> vals) const noexcept {
+        impl::GetBitColumn(*this, objs, vals);
+    }
+
+    /**
+     * @brief Set the values of the field for an array of objects.
+     *
+     * @details
+     * The parent fields are read in chunks first, then the bits are merged in bulk and written back.
+     */
+    void SetColumn(const std::span<const Value> vals, const std::span<Struct> objs) const noexcept {
+        impl::SetBitColumn(*this, vals, objs);
+    }
+
+    //! Get the parent field proxy.
+    constexpr const ParentFieldProxy& GetParent() const noexcept {
+        return parent_;
+    }
+
+    //! Extract the value of the bit field from a value of its parent field.
+    static constexpr Value Extract(const Parent field) noexcept {
+        const auto bits {static_cast<Bits>(static_cast<Bits>(field) >> Offset) & mask};
+        if constexpr (std::same_as<Value, bool>) {
+            return bits != 0;
+        } else {
+            return static_cast<Value>(bits);
+        }
+    }
+
+    //! Insert a new value of the bit field into a value of its parent field.
+    static constexpr Parent Insert(const Parent field, const Value val) noexcept {
+        const auto bits {static_cast<Bits>((static_cast<Bits>(val) & mask) << Offset)};
+        return static_cast<Parent>((static_cast<Bits>(field) & ~shifted_mask) | bits);
+    }
+
+private:
+    ParentFieldProxy parent_;
+};
+
+//! A boolean field proxy within a parent integral field of a structure, whose position is known at compile time.
+template <typename ParentFieldProxy, std::size_t Pos, typename Formatter = std::nullptr_t>
+using StaticBoolField = StaticBitField<ParentFieldProxy, Pos, 1, bool, Formatter>;
+
+/**
+ * @brief A group of bit fields sharing the same parent field.
+ *
+ * @details
+ * Reading or writing the whole group accesses the parent field only once,
+ * instead of once per bit field.
+ *
+ * @tparam BitFields The bit field proxies (e.g., @p BitField or @p StaticBitField).
+ */
+template <typename... BitFields>
+    requires(sizeof...(BitFields) > 0)
+class BitFieldGroup {
+    using FirstBitField = std::tuple_element_t<0, std::tuple<BitFields...>>;
+
+    template <typename T>
+    using ParentOf = std::remove_cvref_t<decltype(std::declval<T>().GetParent())>;
+
+    using ParentFieldProxy = ParentOf<FirstBitField>;
+
+    static_assert((std::same_as<ParentOf<BitFields>, ParentFieldProxy> && ...),
+                  "All bit fields must have the same parent field");
+
+public:
+    using Struct = typename ParentFieldProxy::Struct;
+    using Value = std::tuple<typename BitFields::Value...>;
+
+    /**
+     * @brief Create a new group of bit fields.
+     *
+     * @param fields The bit field proxies, which must have the same parent field.
+     */
+    explicit constexpr BitFieldGroup(BitFields... fields) noexcept :
+        fields_ {std::move(fields)...} {
+        // Parent fields that cannot be identified are only checked by their types.
+        if constexpr (impl::IsIdentifiableField<ParentFieldProxy>) {
+            assert(std::apply(
+                [this](const auto&... field) {
+                    return (impl::IsSameField(field.GetParent(), GetParent()) && ...);
+                },
+                fields_));
         }
+    }
+
+    //! Get the values of all bit fields from an object.
+    Value Get(const Struct& obj) const noexcept {
+        const auto parent {GetParent().Get(obj)};
+        return std::apply(
+            [parent](const auto&... field) { return Value {field.Extract(parent)...}; }, fields_);
+    }
 
-        parent_.Set(obj, field);
+    //! Set all bit fields to new values for an object.
+    const BitFieldGroup& Set(Struct& obj, const typename BitFields::Value... vals) const noexcept {
+        auto parent {GetParent().Get(obj)};
+        std::apply(
+            [&parent, &vals...](const auto&... field) {
+                ((parent = field.Insert(parent, vals)), ...);
+            },
+            fields_);
+        GetParent().Set(obj, parent);
         return *this;
     }
 
+    //! Set all bit fields to new values for an object.
+    const BitFieldGroup& Set(Struct& obj, const Value& vals) const noexcept {
+        return std::apply([this, &obj](const auto&... val) -> const BitFieldGroup& {
+            return Set(obj, val...);
+        }, vals);
+    }
+
 private:
-    ParentFieldProxy parent_;
-    std::size_t bit_offset_;
-    std::size_t bit_width_;
-};
+    constexpr const ParentFieldProxy& GetParent() const noexcept {
+        return std::get<0>(fields_).GetParent();
+    }
 
-//! A boolean field proxy within a parent integral field of a structure.
-template <typename ParentFieldProxy, typename Formatter = std::nullptr_t>
-using BoolField = BitField<ParentFieldProxy, bool, Formatter>;
+    std::tuple<BitFields...> fields_;
+};
 
 template <typename T>
 using FlexibleArray = std::vector<T>;
@@ -317,11 +1312,11 @@ public:
      * Typically, it is used to indicate the byte length of certain header data.
      * @param formatter An optional formatter used for field formatting.
      */
-    explicit constexpr FlexibleArrayField(std::string name, Array Struct::* const array,
+    explicit constexpr FlexibleArrayField(const NameView name, Array Struct::* const array,
                                           const CountFieldProxy count,
                                           const std::size_t min_fixed_count = 0,
                                           Formatter&& formatter = nullptr) noexcept :
-        Named {std::move(name)},
+        Named {name},
         impl::Formattable<Struct, FlexibleArrayField<Struct, Array, CountFieldProxy, Formatter>,
                           FlexibleArray<Element>, Formatter> {std::forward<Formatter>(formatter)},
         count_ {count},
@@ -332,29 +1327,94 @@ public:
 
     //! Get all elements of the field using the count field from an object.
     Value GetAll(const Struct& obj) const noexcept {
-        const auto total_count {count_.Get(obj)};
-        assert(total_count >= min_fixed_count_);
-        if (const auto count {total_count - min_fixed_count_}; count > 0) [[likely]] {
-            const auto base {GetAddr(obj)};
-            return Value(base, base + count);
-        } else {
-            return {};
-        }
+        const auto elems {View(obj)};
+        return Value(elems.begin(), elems.end());
     }
 
     //! Get an element at the specified position of the field from an object.
     const Element& GetAt(const Struct& obj, const std::size_t pos) const noexcept {
-        const auto total_count {count_.Get(obj)};
-        assert(total_count >= min_fixed_count_);
-        const auto count {total_count - min_fixed_count_};
-        assert(pos < count);
-        const auto base {GetAddr(obj)};
-        return *(base + pos);
+        const auto elems {View(obj)};
+        assert(pos < elems.size());
+        return elems[pos];
+    }
+
+    //! Get a view of all elements of the field using the count field from an object, without copying.
+    std::span<const Element> View(const Struct& obj) const noexcept {
+        return {GetAddr(obj), GetCount(obj)};
+    }
+
+    //! @overload
+    std::span<Element> View(Struct& obj) const noexcept {
+        return {GetAddr(obj), GetCount(obj)};
+    }
+
+    //! Get the number of bytes occupied by an object, including all trailing elements of the field.
+    std::size_t GetByteSize(const Struct& obj) const noexcept {
+        return GetByteSize(GetCount(obj));
+    }
+
+    /**
+     * @brief Get the number of bytes occupied by an object with the specified number of elements.
+     *
+     * @param count The number of elements, excluding the fixed count.
+     */
+    std::size_t GetByteSize(const std::size_t count) const noexcept {
+        const auto offset {impl::GetMemberOffset(array_)};
+        return std::max(sizeof(Struct), offset + count * sizeof(Element));
+    }
+
+    //! Get the maximum number of elements, excluding the fixed count, that the count field can represent.
+    constexpr std::size_t GetMaxCount() const noexcept {
+        using Count = std::remove_cvref_t<decltype(count_.Get(std::declval<const Struct&>()))>;
+        if constexpr (std::integral<Count>) {
+            constexpr auto max_count {static_cast<std::size_t>(std::numeric_limits<Count>::max())};
+            return max_count < min_fixed_count_ ? 0 : max_count - min_fixed_count_;
+        } else {
+            return std::numeric_limits<std::size_t>::max();
+        }
+    }
+
+    /**
+     * @brief Validate the count field of an object against the actual size of its buffer.
+     *
+     * @details
+     * Unlike other methods that only check the count field with assertions,
+     * it is safe for untrusted objects.
+     * Once validated, elements can be accessed through the returned view without further checks.
+     *
+     * @param obj The object at the beginning of a buffer.
+     * @param buffer_size The size of the buffer in bytes.
+     * @return A view of all elements, or @p std::nullopt if the elements exceed the buffer.
+     */
+    std::optional<std::span<const Element>> Validate(const Struct& obj,
+                                                     const std::size_t buffer_size) const noexcept {
+        if (const auto count {GetValidCount(obj, buffer_size)}; count.has_value()) [[likely]] {
+            return std::span {GetAddr(obj), *count};
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    //! @overload
+    std::optional<std::span<Element>> Validate(Struct& obj,
+                                               const std::size_t buffer_size) const noexcept {
+        if (const auto count {GetValidCount(obj, buffer_size)}; count.has_value()) [[likely]] {
+            return std::span {GetAddr(obj), *count};
+        } else {
+            return std::nullopt;
+        }
     }
 
     //! Set all elements of the field to new values and optionally updates the count field for an object.
     const FlexibleArrayField& SetAll(Struct& obj, const Value& vals,
                                      const bool update_count = true) const noexcept {
+        return SetAll(obj, std::span<const Element> {vals}, update_count);
+    }
+
+    //! @overload
+    const FlexibleArrayField& SetAll(Struct& obj, const std::span<const Element> vals,
+                                     const bool update_count = true) const noexcept {
+        assert(!update_count || vals.size() <= GetMaxCount());
         const auto base {GetAddr(obj)};
         std::ranges::copy(vals, base);
         if (update_count) {
@@ -367,12 +1427,9 @@ public:
     //! Set an element at the specified position of the field to a new value for an object.
     const FlexibleArrayField& SetAt(Struct& obj, const std::size_t pos,
                                     const Element& elem) const noexcept {
-        const auto total_count {count_.Get(obj)};
-        assert(total_count >= min_fixed_count_);
-        const auto count {total_count - min_fixed_count_};
-        assert(pos < count);
-        const auto base {GetAddr(obj)};
-        *(base + pos) = elem;
+        const auto elems {View(obj)};
+        assert(pos < elems.size());
+        elems[pos] = elem;
         return *this;
     }
 
@@ -387,6 +1444,38 @@ public:
     }
 
 private:
+    std::optional<std::size_t> GetValidCount(const Struct& obj,
+                                             const std::size_t buffer_size) const noexcept {
+        if (buffer_size < sizeof(Struct)) {
+            return std::nullopt;
+        }
+
+        const auto total_count {count_.Get(obj)};
+        if constexpr (std::signed_integral<std::remove_cvref_t<decltype(total_count)>>) {
+            if (total_count < 0) {
+                return std::nullopt;
+            }
+        }
+
+        if (static_cast<std::size_t>(total_count) < min_fixed_count_) {
+            return std::nullopt;
+        }
+
+        const auto count {static_cast<std::size_t>(total_count) - min_fixed_count_};
+        const auto offset {impl::GetMemberOffset(array_)};
+        if (count > (buffer_size - offset) / sizeof(Element)) {
+            return std::nullopt;
+        }
+
+        return count;
+    }
+
+    std::size_t GetCount(const Struct& obj) const noexcept {
+        const auto total_count {static_cast<std::size_t>(count_.Get(obj))};
+        assert(total_count >= min_fixed_count_);
+        return total_count - min_fixed_count_;
+    }
+
     const Element* GetAddr(const Struct& obj) const noexcept {
         return std::addressof((obj.*array_)[0]);
     }
@@ -418,50 +1507,265 @@ private:
     T val_;
 };
 
+/**
+ * @brief A forward range over back-to-back records in a byte buffer, each followed by its flexible array elements.
+ *
+ * @details
+ * The size of each record is computed from the count field of its flexible array.
+ * Each record is validated once, and iteration stops at the first record that is truncated, invalid or misaligned.
+ * The reason is reported by the iterator, so a stream that stops early can be told apart from one that is fully consumed.
+ * No data is copied.
+ *
+ * @tparam FlexibleArrayFieldProxy The flexible array field proxy (e.g., @p FlexibleArrayField) of records.
+ *
+ * @warning
+ * Records are accessed in place, so the buffer and each record must be suitably aligned for the structure.
+ */
+template <typename FlexibleArrayFieldProxy>
+class RecordStream : public std::ranges::view_interface<RecordStream<FlexibleArrayFieldProxy>> {
+public:
+    using Struct = typename FlexibleArrayFieldProxy::Struct;
+    using Element = typename FlexibleArrayFieldProxy::Element;
+
+    static_assert(std::is_trivially_copyable_v<Struct>);
+
+    //! The reason why iteration stops.
+    enum class Stop {
+        //! All bytes have been consumed.
+        End,
+        //! The remaining bytes are too few for a record, or its count field exceeds them.
+        Invalid,
+        //! The next record is not suitably aligned for the structure, so it cannot be accessed in place.
+        Misaligned
+    };
+
+    //! A validated record.
+    struct Record {
+        //! The record object.
+        const Struct& obj;
+
+        //! The flexible array elements of the record.
+        std::span<const Element> elems;
+
+        //! The bytes of the record, including its flexible array elements.
+        std::span<const std::byte> bytes;
+    };
+
+    //! An iterator over records.
+    class Iterator {
+    public:
+        using value_type = Record;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() noexcept = default;
+
+        Iterator(const std::span<const std::byte> remain, FlexibleArrayFieldProxy field) noexcept :
+            remain_ {remain}, field_ {std::move(field)} {
+            Parse();
+        }
+
+        Record operator*() const noexcept {
+            assert(curr_.has_value());
+            return {*curr_->obj, curr_->elems, remain_.first(curr_->size)};
+        }
+
+        Iterator& operator++() noexcept {
+            assert(curr_.has_value());
+            remain_ = remain_.subspan(curr_->size);
+            Parse();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            auto old {*this};
+            ++*this;
+            return old;
+        }
+
+        //! Get the bytes after the current record, or the unparsed bytes after the last valid record.
+        std::span<const std::byte> GetRemaining() const noexcept {
+            return curr_.has_value() ? remain_.subspan(curr_->size) : remain_;
+        }
+
+        //! Get the reason why iteration has stopped, once the iterator reaches the end.
+        Stop GetStop() const noexcept {
+            assert(!curr_.has_value());
+            return stop_;
+        }
+
+        bool operator==(const Iterator& other) const noexcept {
+            return remain_.data() == other.remain_.data()
+                   && curr_.has_value() == other.curr_.has_value();
+        }
+
+        bool operator==(std::default_sentinel_t) const noexcept {
+            return !curr_.has_value();
+        }
+
+    private:
+        struct Parsed {
+            const Struct* obj;
+            std::span<const Element> elems;
+            std::size_t size;
+        };
+
+        void Parse() noexcept {
+            curr_.reset();
+            if (remain_.empty()) {
+                stop_ = Stop::End;
+                return;
+            } else if (remain_.size() < sizeof(Struct)) {
+                stop_ = Stop::Invalid;
+                return;
+            } else if (reinterpret_cast<std::uintptr_t>(remain_.data()) % alignof(Struct) != 0) {
+                // Nothing is read from a misaligned record.
+                stop_ = Stop::Misaligned;
+                return;
+            }
+
+            const auto obj {reinterpret_cast<const Struct*>(remain_.data())};
+            if (const auto elems {field_->Validate(*obj, remain_.size())}; elems.has_value()) {
+                curr_ = Parsed {obj, *elems, field_->GetByteSize(*obj)};
+            } else {
+                stop_ = Stop::Invalid;
+            }
+        }
+
+        std::span<const std::byte> remain_;
+        // The proxy is held by value, so iterators remain valid after the stream is gone.
+        // It is optional only because iterators must be default-constructible.
+        std::optional<FlexibleArrayFieldProxy> field_;
+        std::optional<Parsed> curr_;
+        Stop stop_ {Stop::End};
+    };
+
+    /**
+     * @brief Create a new record stream.
+     *
+     * @param buffer The byte buffer containing back-to-back records.
+     * @param field The flexible array field proxy of records.
+     */
+    explicit RecordStream(const std::span<const std::byte> buffer,
+                          FlexibleArrayFieldProxy field) noexcept :
+        buffer_ {buffer}, field_ {std::move(field)} {}
+
+    Iterator begin() const noexcept {
+        return Iterator {buffer_, field_};
+    }
+
+    std::default_sentinel_t end() const noexcept {
+        return std::default_sentinel;
+    }
+
+private:
+    std::span<const std::byte> buffer_;
+    FlexibleArrayFieldProxy field_;
+};
+
 //! Make a regular field proxy in a structure.
 template <typename Struct, typename RawField, typename Formatter = std::nullptr_t>
-constexpr auto MakeField(std::string name, RawField Struct::* const field,
+constexpr auto MakeField(const NameView name, RawField Struct::* const field,
                          Formatter&& formatter = nullptr) noexcept {
-    return Field<Struct, RawField, Formatter> {std::move(name), field,
-                                               std::forward<Formatter>(formatter)};
+    return Field<Struct, RawField, Formatter> {name, field, std::forward<Formatter>(formatter)};
 }
 
 //! @overload
 template <typename Struct, typename RawField, typename Formatter = std::nullptr_t>
-constexpr auto MakeField(std::string name, RawField Struct::* const field, const std::endian endian,
-                         Formatter&& formatter = nullptr) noexcept {
-    return Field<Struct, RawField, Formatter> {std::move(name), field, endian,
+constexpr auto MakeField(const NameView name, RawField Struct::* const field,
+                         const std::endian endian, Formatter&& formatter = nullptr) noexcept {
+    return Field<Struct, RawField, Formatter> {name, field, endian,
                                                std::forward<Formatter>(formatter)};
 }
 
+/**
+ * @brief Make an integral field proxy whose endianness is known at compile time.
+ *
+ * @tparam Endian The endianness of the field.
+ */
+template <std::endian Endian, typename Struct, typename RawField,
+          typename Formatter = std::nullptr_t>
+constexpr auto MakeField(const NameView name, RawField Struct::* const field,
+                         Formatter&& formatter = nullptr) noexcept {
+    return Field<Struct, RawField, Formatter, Endian> {name, field,
+                                                       std::forward<Formatter>(formatter)};
+}
+
+/**
+ * @brief Make a regular field proxy whose member, name and endianness are all known at compile time.
+ *
+ * @tparam Member A pointer-to-member specifying the field within the structure.
+ * @tparam Name The field name.
+ * @tparam Endian The endianness of the field.
+ */
+template <auto Member, impl::FixedString Name, std::endian Endian = std::endian::native,
+          typename Formatter = std::nullptr_t>
+constexpr auto MakeStaticField(Formatter&& formatter = nullptr) noexcept {
+    return StaticField<Member, Name, Endian, Formatter> {std::forward<Formatter>(formatter)};
+}
+
 //! Make a bit field proxy within a parent integral field of a structure.
 template <typename ParentFieldProxy, typename Target = typename ParentFieldProxy::Value,
           typename Formatter = std::nullptr_t>
     requires(!std::same_as<Target, bool>)
-constexpr auto MakeBitField(std::string name, const ParentFieldProxy parent,
+constexpr auto MakeBitField(const NameView name, const ParentFieldProxy parent,
                             const std::size_t offset, const std::size_t width,
                             Formatter&& formatter = nullptr) noexcept {
-    return BitField<ParentFieldProxy, Target, Formatter> {std::move(name), parent, offset, width,
+    return BitField<ParentFieldProxy, Target, Formatter> {name, parent, offset, width,
                                                           std::forward<Formatter>(formatter)};
 }
 
+/**
+ * @brief Make a bit field proxy within a parent integral field of a structure, whose offset and width are known at compile time.
+ *
+ * @tparam Offset The offset in bits from the least significant bit of the parent field.
+ * @tparam Width The width of the bit field in bits.
+ * @tparam Target The type of the bit field, the default is the type of the parent field.
+ */
+template <std::size_t Offset, std::size_t Width, typename Target = void, typename ParentFieldProxy,
+          typename Formatter = std::nullptr_t>
+constexpr auto MakeBitField(const NameView name, const ParentFieldProxy parent,
+                            Formatter&& formatter = nullptr) noexcept {
+    using Value =
+        std::conditional_t<std::is_void_v<Target>, typename ParentFieldProxy::Value, Target>;
+    return StaticBitField<ParentFieldProxy, Offset, Width, Value, Formatter> {
+        name, parent, std::forward<Formatter>(formatter)};
+}
+
 //! Make a boolean field proxy within a parent integral field of a structure.
 template <typename ParentFieldProxy, typename Formatter = std::nullptr_t>
-constexpr auto MakeBoolField(std::string name, const ParentFieldProxy parent,
+constexpr auto MakeBoolField(const NameView name, const ParentFieldProxy parent,
                              const std::size_t bit_pos, Formatter&& formatter = nullptr) noexcept {
-    return BoolField<ParentFieldProxy, Formatter> {std::move(name), parent, bit_pos,
+    return BoolField<ParentFieldProxy, Formatter> {name, parent, bit_pos,
                                                    std::forward<Formatter>(formatter)};
 }
 
+/**
+ * @brief Make a boolean field proxy within a parent integral field of a structure, whose position is known at compile time.
+ *
+ * @tparam Pos The offset in bits from the least significant bit of the parent field.
+ */
+template <std::size_t Pos, typename ParentFieldProxy, typename Formatter = std::nullptr_t>
+constexpr auto MakeBoolField(const NameView name, const ParentFieldProxy parent,
+                             Formatter&& formatter = nullptr) noexcept {
+    return StaticBoolField<ParentFieldProxy, Pos, Formatter> {name, parent,
+                                                             std::forward<Formatter>(formatter)};
+}
+
+//! Make a group of bit fields sharing the same parent field.
+template <typename... BitFields>
+constexpr auto MakeBitFieldGroup(const BitFields... fields) noexcept {
+    return BitFieldGroup<BitFields...> {fields...};
+}
+
 //! Make a flexible array field proxy within a structure where the element count is specified by another field.
 template <typename Struct, typename Array, typename CountFieldProxy,
           typename Formatter = std::nullptr_t>
-constexpr auto MakeFlexibleArrayField(std::string name, Array Struct::* const array,
+constexpr auto MakeFlexibleArrayField(const NameView name, Array Struct::* const array,
                                       const CountFieldProxy count,
                                       const std::size_t min_fixed_count = 0,
                                       Formatter&& formatter = nullptr) noexcept {
     return FlexibleArrayField<Struct, Array, CountFieldProxy, Formatter> {
-        std::move(name), array, count, min_fixed_count, std::forward<Formatter>(formatter)};
+        name, array, count, min_fixed_count, std::forward<Formatter>(formatter)};
 }
 
 //! Make a constant value wrapper to allow proxy-like reading.
@@ -470,17 +1774,332 @@ constexpr auto MakeConstant(T val) noexcept {
     return Constant {std::move(val)};
 }
 
+//! Make a forward range over back-to-back records in a byte buffer, each followed by its flexible array elements.
+template <typename FlexibleArrayFieldProxy>
+auto MakeRecordStream(const std::span<const std::byte> buffer,
+                      const FlexibleArrayFieldProxy& field) noexcept {
+    return RecordStream<FlexibleArrayFieldProxy> {buffer, field};
+}
+
+/**
+ * @brief Extract the values of a field from an array of objects into a column.
+ *
+ * @details
+ * Loop-invariant work such as checking the endianness or computing bit masks is done once per batch,
+ * so the loop over objects can be vectorized by the compiler.
+ *
+ * @param field A field proxy (e.g., @p Field, @p BitField or @p BoolField).
+ * @param objs The objects.
+ * @param vals The output column, which must be at least as large as @p objs.
+ */
+template <typename FieldProxy>
+void ExtractColumn(const FieldProxy& field, const std::span<const typename FieldProxy::Struct> objs,
+                   const std::span<typename FieldProxy::Value> vals) noexcept {
+    impl::GetColumn(field, objs, vals);
+}
+
+/**
+ * @brief Scatter the values of a column into a field of an array of objects.
+ *
+ * @details
+ * It is the inverse of @ref ExtractColumn.
+ * Byte swapping and bit merging are done in bulk instead of once per object.
+ *
+ * @param field A field proxy (e.g., @p Field, @p BitField or @p BoolField).
+ * @param vals The input column, which must be at least as large as @p objs.
+ * @param objs The objects.
+ */
+template <typename FieldProxy>
+void ScatterColumn(const FieldProxy& field, const std::span<const typename FieldProxy::Value> vals,
+                   const std::span<typename FieldProxy::Struct> objs) noexcept {
+    impl::SetColumn(field, vals, objs);
+}
+
+/**
+ * @brief Extract the values of multiple fields from an array of objects into columns.
+ *
+ * @details
+ * Objects are processed in chunks, so each chunk stays in cache while all fields are extracted from it.
+ *
+ * @param fields A tuple of field proxies of the same structure.
+ * @param objs The objects.
+ * @param vals The output columns, one for each field, which must be at least as large as @p objs.
+ */
+template <typename... Fields>
+    requires(sizeof...(Fields) > 0)
+void ExtractColumns(
+    const std::tuple<Fields...>& fields,
+    const std::span<const typename std::tuple_element_t<0, std::tuple<Fields...>>::Struct> objs,
+    const std::span<typename Fields::Value>... vals) noexcept {
+    for (std::size_t begin {0}; begin < objs.size(); begin += impl::column_chunk_size) {
+        const auto count {std::min(impl::column_chunk_size, objs.size() - begin)};
+        const auto chunk {objs.subspan(begin, count)};
+        std::apply(
+            [chunk, begin, count, &vals...](const auto&... field) {
+                (impl::GetColumn(field, chunk, vals.subspan(begin, count)), ...);
+            },
+            fields);
+    }
+}
+
+/**
+ * @brief Format all fields from a tuple to an output iterator, one field per line.
+ *
+ * @return The iterator past the end of the formatted fields.
+ */
+template <std::output_iterator<char> OutputIt, typename Struct, typename... Fields>
+OutputIt FormatFields(OutputIt out, const Struct& obj, const std::tuple<Fields...>& fields) {
+    std::apply(
+        [&obj, &out](const auto&... field) {
+            ((out = field.FormatTo(std::move(out), obj), *out++ = '\n'), ...);
+        },
+        fields);
+    return out;
+}
+
+//! Format all fields from a tuple and append them to a string, one field per line.
+template <typename Struct, typename... Fields>
+std::string& FormatFields(std::string& buffer, const Struct& obj,
+                          const std::tuple<Fields...>& fields) {
+    FormatFields(std::back_inserter(buffer), obj, fields);
+    return buffer;
+}
+
+/**
+ * @brief Format all fields from a tuple to a fixed-size buffer, one field per line.
+ *
+ * @details
+ * Characters that do not fit into the buffer are discarded.
+ *
+ * @return
+ * The pointer past the last written character,
+ * and the total number of characters without truncation, like @p std::format_to_n.
+ */
+template <typename Struct, typename... Fields>
+std::format_to_n_result<char*> FormatFields(const std::span<char> buffer, const Struct& obj,
+                                            const std::tuple<Fields...>& fields) {
+    const auto out {FormatFields(impl::TruncatingIterator {buffer}, obj, fields)};
+    const auto size {out.GetCount()};
+    return {buffer.data() + std::min(size, buffer.size()),
+            static_cast<std::ptrdiff_t>(size)};
+}
+
+/**
+ * @brief Format the fields from a tuple that differ between two objects, one change per two lines.
+ *
+ * @details
+ * Each changed field is written as @p "- <old>" and @p "+ <new>" lines.
+ * Raw values are compared first and only changed fields are formatted,
+ * so the cost scales with the number of changes rather than the number of fields.
+ * If the structure has no padding and no field refers to elements after it,
+ * identical objects are detected by a single @p std::memcmp over the whole structure.
+ *
+ * @return The iterator past the end of the formatted changes.
+ */
+template <std::output_iterator<char> OutputIt, typename Struct, typename... Fields>
+OutputIt DiffFields(OutputIt out, const Struct& old_obj, const Struct& new_obj,
+                    const std::tuple<Fields...>& fields) {
+    if constexpr (std::has_unique_object_representations_v<Struct>
+                  && !(impl::HasElementView<Fields> || ...)) {
+        if (std::memcmp(std::addressof(old_obj), std::addressof(new_obj), sizeof(Struct)) == 0) {
+            return out;
+        }
+    }
+
+    std::apply(
+        [&old_obj, &new_obj, &out](const auto&... field) {
+            const auto diff {[&old_obj, &new_obj, &out](const auto& proxy) {
+                if (!impl::FieldEquals(proxy, old_obj, new_obj)) {
+                    *out++ = '-';
+                    *out++ = ' ';
+                    out = proxy.FormatTo(std::move(out), old_obj);
+                    *out++ = '\n';
+                    *out++ = '+';
+                    *out++ = ' ';
+                    out = proxy.FormatTo(std::move(out), new_obj);
+                    *out++ = '\n';
+                }
+            }};
+            (diff(field), ...);
+        },
+        fields);
+    return out;
+}
+
+//! Format the fields from a tuple that differ between two objects and append them to a string.
+template <typename Struct, typename... Fields>
+std::string& DiffFields(std::string& buffer, const Struct& old_obj, const Struct& new_obj,
+                        const std::tuple<Fields...>& fields) {
+    DiffFields(std::back_inserter(buffer), old_obj, new_obj, fields);
+    return buffer;
+}
+
+/**
+ * @brief Hash the values of fields from a tuple within an object.
+ *
+ * @details
+ * Regular fields whose members are adjacent in the structure are hashed as one run of raw bytes.
+ * Other fields are hashed by their values, and flexible arrays by their elements.
+ * The result only depends on the field values, but is not portable across platforms.
+ */
+template <typename Struct, typename... Fields>
+std::uint64_t HashFields(const Struct& obj, const std::tuple<Fields...>& fields) noexcept {
+    impl::Hasher hasher;
+    const auto bytes {reinterpret_cast<const std::byte*>(std::addressof(obj))};
+    std::size_t run_begin {0};
+    std::size_t run_end {0};
+    const auto flush {[&hasher, bytes, &run_begin, &run_end] {
+        if (run_begin != run_end) {
+            hasher.Update(std::span {bytes + run_begin, bytes + run_end});
+            run_begin = run_end;
+        }
+    }};
+
+    std::apply(
+        [&](const auto&... field) {
+            const auto hash {[&](const auto& proxy) {
+                using FieldProxy = std::remove_cvref_t<decltype(proxy)>;
+                if constexpr (impl::HasHashableMember<FieldProxy>) {
+                    const auto offset {impl::GetMemberOffset(proxy.GetMember())};
+                    if (offset != run_end) {
+                        flush();
+                        run_begin = offset;
+                    }
+
+                    run_end = offset + sizeof(typename FieldProxy::Value);
+                } else {
+                    flush();
+                    impl::HashField(hasher, proxy, obj);
+                }
+            }};
+            (hash(field), ...);
+        },
+        fields);
+    flush();
+    return hasher.Finish();
+}
+
+/**
+ * @brief Hash the values of fields from a tuple within an array of objects.
+ *
+ * @details
+ * The runs of adjacent members only depend on the fields, so they are found once for all objects.
+ * Then each run or other field is hashed across a chunk of objects before moving to the next one.
+ * The hashes are the same as those returned for each object.
+ *
+ * @param objs The objects.
+ * @param fields A tuple of field proxies of the structure.
+ * @param hashes The output hashes, which must be at least as large as @p objs.
+ */
+template <typename Struct, typename... Fields>
+void HashFields(const std::span<const Struct> objs, const std::tuple<Fields...>& fields,
+                const std::span<std::uint64_t> hashes) noexcept {
+    assert(hashes.size() >= objs.size());
+
+    // The byte run "[begin, end)" hashed before each field, and the last one after all fields.
+    using Run = std::pair<std::size_t, std::size_t>;
+    std::array<Run, sizeof...(Fields) + 1> runs {};
+    {
+        std::size_t pos {0};
+        std::size_t run_begin {0};
+        std::size_t run_end {0};
+        const auto flush {[&runs, &pos, &run_begin, &run_end] {
+            if (run_begin != run_end) {
+                runs[pos] = {run_begin, run_end};
+                run_begin = run_end;
+            }
+        }};
+
+        std::apply(
+            [&](const auto&... field) {
+                const auto plan {[&](const auto& proxy) {
+                    using FieldProxy = std::remove_cvref_t<decltype(proxy)>;
+                    if constexpr (impl::HasHashableMember<FieldProxy>) {
+                        const auto offset {impl::GetMemberOffset(proxy.GetMember())};
+                        if (offset != run_end) {
+                            flush();
+                            run_begin = offset;
+                        }
+
+                        run_end = offset + sizeof(typename FieldProxy::Value);
+                    } else {
+                        flush();
+                    }
+
+                    ++pos;
+                }};
+                (plan(field), ...);
+            },
+            fields);
+        flush();
+    }
+
+    std::array<impl::Hasher, impl::column_chunk_size> hashers;
+    for (std::size_t begin {0}; begin < objs.size(); begin += hashers.size()) {
+        const auto chunk {objs.subspan(begin, std::min(hashers.size(), objs.size() - begin))};
+        std::ranges::fill(hashers, impl::Hasher {});
+        const auto hash_run {[&hashers, chunk](const Run& run) {
+            if (run.first != run.second) {
+                for (std::size_t i {0}; i != chunk.size(); ++i) {
+                    const auto bytes {reinterpret_cast<const std::byte*>(std::addressof(chunk[i]))};
+                    hashers[i].Update(std::span {bytes + run.first, bytes + run.second});
+                }
+            }
+        }};
+
+        std::apply(
+            [&](const auto&... field) {
+                std::size_t pos {0};
+                const auto hash {[&](const auto& proxy) {
+                    hash_run(runs[pos++]);
+                    if constexpr (!impl::HasHashableMember<std::remove_cvref_t<decltype(proxy)>>) {
+                        for (std::size_t i {0}; i != chunk.size(); ++i) {
+                            impl::HashField(hashers[i], proxy, chunk[i]);
+                        }
+                    }
+                }};
+                (hash(field), ...);
+            },
+            fields);
+        hash_run(runs.back());
+
+        for (std::size_t i {0}; i != chunk.size(); ++i) {
+            hashes[begin + i] = hashers[i].Finish();
+        }
+    }
+}
+
+/**
+ * @brief Print all formatted fields from a tuple to the provided output stream.
+ *
+ * @details
+ * All fields are formatted into a caller-provided buffer first and then written to the stream at once.
+ * Reusing the buffer across calls avoids allocation once it has grown large enough.
+ */
+template <typename Struct, typename... Fields>
+std::ostream& PrintFields(std::ostream& os, const Struct& obj, const std::tuple<Fields...>& fields,
+                          std::string& buffer) {
+    buffer.clear();
+    FormatFields(buffer, obj, fields);
+    return os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
 //! Print all formatted fields from a tuple to the provided output stream.
 template <typename Struct, typename... Fields>
 std::ostream& PrintFields(std::ostream& os, const Struct& obj,
                           const std::tuple<Fields...>& fields) {
-    std::apply([&obj, &os](const auto&... field) { ((os << field.Format(obj) << '\n'), ...); },
-               fields);
-    return os;
+    std::string buffer;
+    return PrintFields(os, obj, fields, buffer);
 }
 
 }  // namespace field_access_proxy
 
+//! Iterators of a record stream refer only to its buffer, so they outlive the stream.
+template <typename FlexibleArrayFieldProxy>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<field_access_proxy::RecordStream<FlexibleArrayFieldProxy>> {
+        true};
+
 /**
  * @brief Define a private regular field with an associated proxy in a structure.
  *
@@ -488,7 +2107,7 @@ std::ostream& PrintFields(std::ostream& os, const Struct& obj,
  * This macro declares the following elements within @p StructType,
  * typically used to define underlying integral fields for bit fields.
  * - A @p access_specifier member field @p field_name of type @p FieldType, optionally be initialized via @p field_init.
- * - A static private field proxy @p <field_name>_proxy of type @p Field.
+ * - A static private constexpr field proxy @p <field_name>_proxy of type @p Field.
  *
  * @param StructType The structure type.
  * @param access_specifier The access specifier for the field (e.g., @p private, @p protected).
@@ -502,18 +2121,22 @@ std::ostream& PrintFields(std::ostream& os, const Struct& obj,
     FieldType field_name field_init;                                                            \
                                                                                                 \
 private:                                                                                        \
-    inline static const auto field_name##_proxy {                                               \
+    static constexpr auto field_name##_proxy {                                                  \
         ::field_access_proxy::MakeField(#field_name, &StructType::field_name)};
 
-//! @overload
+/**
+ * @overload
+ *
+ * @param endian The endianness of the field, which must be a constant expression.
+ */
 #define DEFINE_UNDERLYING_INTEGRAL_FIELD_WITH_ENDIAN_PROXY(                  \
     StructType, access_specifier, FieldType, field_name, endian, field_init) \
     access_specifier:                                                        \
     FieldType field_name field_init;                                         \
                                                                              \
 private:                                                                     \
-    inline static const auto field_name##_proxy {                            \
-        ::field_access_proxy::MakeField(#field_name, &StructType::field_name, endian)};
+    static constexpr auto field_name##_proxy {                               \
+        ::field_access_proxy::MakeField<endian>(#field_name, &StructType::field_name)};
 
 /**
  * @brief Define a regular field with an associated proxy and accessors in a structure.
@@ -538,7 +2161,11 @@ private:                                                                     \
     DEFINE_UNDERLYING_FIELD_WITH_PROXY(StructType, field_access_specifier, FieldType, field_name, \
                                        field_init)
 
-//! @overload
+/**
+ * @overload
+ *
+ * @param endian The endianness of the field, which must be a constant expression.
+ */
 #define DEFINE_INTEGRAL_FIELD_WITH_ENDIAN_PROXY(StructType, FieldType, property_access_specifier,  \
                                                 property_name, field_access_specifier, field_name, \
                                                 endian, field_init)                                \
@@ -560,7 +2187,7 @@ private:                                                                     \
  *
  * @details
  * This macro declares the following elements within @p StructType:
- * - A static private bit field proxy @p <property_name>_proxy of type @p BitField.
+ * - A static private constexpr bit field proxy @p <property_name>_proxy of type @p StaticBitField.
  * - @p access_specifier member methods @p Get<property_name> and @p Set<property_name>.
  *
  * @param StructType The structure type.
@@ -570,8 +2197,9 @@ private:                                                                     \
  * @param access_specifier The access specifier for the getter and setter (e.g., @p private, @p protected).
  * @param FieldType The raw type of the bit field (e.g., @p std::uint8_t).
  * @param property_name The property name without quotes used in the getter and setter.
- * @param bit_offset The offset in bits from the least significant bit of the parent field.
- * @param bit_width The width of the bit field in bits.
+ * @param bit_offset
+ * The offset in bits from the least significant bit of the parent field, which must be a constant expression.
+ * @param bit_width The width of the bit field in bits, which must be a constant expression.
  */
 #define DEFINE_BIT_FIELD_WITH_PROXY(StructType, parent_field_name, access_specifier, FieldType, \
                                     property_name, bit_offset, bit_width)                       \
@@ -586,15 +2214,16 @@ private:                                                                     \
     }                                                                                           \
                                                                                                 \
 private:                                                                                        \
-    inline static const auto property_name##_proxy {::field_access_proxy::MakeBitField(         \
-        #property_name, parent_field_name##_proxy, bit_offset, bit_width)};
+    static constexpr auto property_name##_proxy {                                               \
+        ::field_access_proxy::MakeBitField<bit_offset, bit_width, FieldType>(                   \
+            #property_name, parent_field_name##_proxy)};
 
 /**
  * @brief Define a boolean field with an associated proxy and accessors in a structure.
  *
  * @details
  * This macro declares the following elements within @p StructType:
- * - A static private boolean field proxy @p <field_name>_proxy of type @p BoolField.
+ * - A static private constexpr boolean field proxy @p <field_name>_proxy of type @p StaticBoolField.
  * - @p access_specifier member methods @p getter_name and @p setter_name.
  *
  * @param StructType The structure type.
@@ -605,7 +2234,8 @@ private:
  * @param getter_name The getter name without quotes.
  * @param setter_name The setter name without quotes.
  * @param field_name The bit field name without quotes.
- * @param bit_pos The offset in bits from the least significant bit of the parent field.
+ * @param bit_pos
+ * The offset in bits from the least significant bit of the parent field, which must be a constant expression.
  */
 #define DEFINE_BOOL_FIELD_WITH_PROXY(StructType, parent_field_name, access_specifier, getter_name, \
                                      setter_name, field_name, bit_pos)                             \
@@ -620,8 +2250,8 @@ private:
     }                                                                                              \
                                                                                                    \
 private:                                                                                           \
-    inline static const auto field_name##_proxy {                                                  \
-        ::field_access_proxy::MakeBoolField(#field_name, parent_field_name##_proxy, bit_pos)};
+    static constexpr auto field_name##_proxy {                                                     \
+        ::field_access_proxy::MakeBoolField<bit_pos>(#field_name, parent_field_name##_proxy)};
 
 /**
  * @brief Define a flexible array field with an associated proxy and accessors in a structure.
@@ -629,8 +2259,9 @@ private:
  * @details
  * This macro declares the following elements within @p StructType:
  * - A @p field_access_specifier flexible array member @p first_<field_name> of type @p ElementType[1], used as the flexible array placeholder.
- * - A static private proxy field @p <field_name>_proxy of type @p FlexibleArrayField.
+ * - A static private constexpr proxy field @p <field_name>_proxy of type @p FlexibleArrayField.
  * - @p property_access_specifier member methods @p Get<property_name> and @p Set<property_name>.
+ * - @p property_access_specifier member methods @p View<property_name>, which return a view of the elements without copying.
  *
  * @param StructType The structure type.
  * @param ElementType The element type of the flexible array.
@@ -655,6 +2286,14 @@ private:
         return field_name##_proxy.GetAll(*this);                                                   \
     }                                                                                              \
                                                                                                    \
+    auto View##property_name() const noexcept {                                                    \
+        return field_name##_proxy.View(*this);                                                     \
+    }                                                                                              \
+                                                                                                   \
+    auto View##property_name() noexcept {                                                          \
+        return field_name##_proxy.View(*this);                                                     \
+    }                                                                                              \
+                                                                                                   \
     StructType& Set##property_name(                                                                \
         const ::field_access_proxy::FlexibleArray<ElementType>& vals) noexcept {                   \
         field_name##_proxy.SetAll(*this, vals, true);                                              \
@@ -665,5 +2304,5 @@ private:
     ElementType first_##field_name[1] {};                                                          \
                                                                                                    \
 private:                                                                                           \
-    inline static const auto field_name##_proxy {::field_access_proxy::MakeFlexibleArrayField(     \
+    static constexpr auto field_name##_proxy {::field_access_proxy::MakeFlexibleArrayField(        \
         #field_name, &StructType::first_##field_name, count_field_name##_proxy, min_fixed_count)};
@@ -0,0 +1,204 @@
+/**
+ * @file field_index.h
+ * @brief A hash index from the values of a field to the positions of records.
+ *
+ * @par GitHub
+ * https://github.com/Zhuagenborn
+ */
+
+#pragma once
+
+#include "field_access_proxy.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace field_access_proxy {
+
+/**
+ * @brief A hash index from the values of a field to the positions of records.
+ *
+ * @details
+ * Distinct values are stored in an open-addressing table with linear probing,
+ * so a lookup usually touches a single cache line.
+ * Positions of records with the same value are chained in insertion order,
+ * and are visited from the most recently inserted one.
+ *
+ * @tparam FieldProxy The field proxy (e.g., @p Field or @p BitField) whose values are indexed.
+ */
+template <typename FieldProxy>
+class FieldIndex {
+public:
+    using Struct = typename FieldProxy::Struct;
+    using Key = std::remove_cvref_t<decltype(std::declval<const FieldProxy&>().Get(
+        std::declval<const Struct&>()))>;
+
+    static_assert(std::equality_comparable<Key>);
+
+    //! Create an empty index.
+    explicit FieldIndex(FieldProxy field) noexcept : field_ {std::move(field)} {}
+
+    //! Rebuild the index from an array of records, whose positions are their indices.
+    void Build(const std::span<const Struct> objs) {
+        Clear();
+        Reserve(objs.size());
+        for (std::size_t i {0}; i != objs.size(); ++i) {
+            Insert(objs[i], i);
+        }
+    }
+
+    /**
+     * @brief Insert the position of a record.
+     *
+     * @param obj The record.
+     * @param pos The position of the record, such as its index in an array.
+     */
+    void Insert(const Struct& obj, const std::size_t pos) {
+        if ((key_count_ + 1) * max_load_den > slots_.size() * max_load_num) {
+            Rehash(std::max(slots_.size() * 2, min_slot_count));
+        }
+
+        auto key {field_.Get(obj)};
+        const auto hash {Hash(key)};
+        auto& slot {slots_[Probe(key, hash)]};
+        if (slot.head == empty) {
+            slot.key = std::move(key);
+            slot.hash = hash;
+            ++key_count_;
+        }
+
+        entries_.push_back({pos, slot.head});
+        slot.head = entries_.size() - 1;
+    }
+
+    //! Get the position of the most recently inserted record with a value, if any.
+    std::optional<std::size_t> Find(const Key& key) const noexcept {
+        if (const auto head {GetHead(key)}; head != empty) {
+            return entries_[head].pos;
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    //! Call a function with the position of each record with a value, from the most recently inserted one.
+    template <typename Func>
+    void ForEach(const Key& key, Func&& func) const {
+        for (auto i {GetHead(key)}; i != empty; i = entries_[i].next) {
+            func(entries_[i].pos);
+        }
+    }
+
+    //! Get the number of records with a value.
+    std::size_t Count(const Key& key) const noexcept {
+        std::size_t count {0};
+        for (auto i {GetHead(key)}; i != empty; i = entries_[i].next) {
+            ++count;
+        }
+
+        return count;
+    }
+
+    //! Get the number of indexed records.
+    std::size_t GetSize() const noexcept {
+        return entries_.size();
+    }
+
+    //! Get the number of distinct values.
+    std::size_t GetKeyCount() const noexcept {
+        return key_count_;
+    }
+
+    /**
+     * @brief Allocate memory for a number of records in advance.
+     *
+     * @details
+     * The table of distinct values still grows on demand, since records often share values.
+     */
+    void Reserve(const std::size_t count) {
+        entries_.reserve(count);
+    }
+
+    //! Remove all records.
+    void Clear() noexcept {
+        slots_.assign(slots_.size(), Slot {});
+        entries_.clear();
+        key_count_ = 0;
+    }
+
+private:
+    static constexpr std::size_t empty {std::numeric_limits<std::size_t>::max()};
+    static constexpr std::size_t min_slot_count {16};
+
+    //! The maximum ratio of distinct values to slots.
+    static constexpr std::size_t max_load_num {3};
+    static constexpr std::size_t max_load_den {4};
+
+    //! A distinct value and the latest entry with it.
+    struct Slot {
+        Key key {};
+        std::uint64_t hash {0};
+        std::size_t head {empty};
+    };
+
+    //! The position of a record and the previous entry with the same value.
+    struct Entry {
+        std::size_t pos;
+        std::size_t next;
+    };
+
+    static std::uint64_t Hash(const Key& key) noexcept {
+        impl::Hasher hasher;
+        impl::HashValue(hasher, key);
+        return hasher.Finish();
+    }
+
+    //! Find the slot of a value, or the empty slot where it should be inserted.
+    std::size_t Probe(const Key& key, const std::uint64_t hash) const noexcept {
+        assert(std::has_single_bit(slots_.size()));
+        const auto mask {slots_.size() - 1};
+        for (auto i {static_cast<std::size_t>(hash) & mask};; i = (i + 1) & mask) {
+            const auto& slot {slots_[i]};
+            if (slot.head == empty || (slot.hash == hash && slot.key == key)) {
+                return i;
+            }
+        }
+    }
+
+    std::size_t GetHead(const Key& key) const noexcept {
+        return slots_.empty() ? empty : slots_[Probe(key, Hash(key))].head;
+    }
+
+    void Rehash(const std::size_t slot_count) {
+        auto slots {std::exchange(slots_, std::vector<Slot>(slot_count))};
+        for (auto& slot : slots) {
+            if (slot.head != empty) {
+                slots_[Probe(slot.key, slot.hash)] = std::move(slot);
+            }
+        }
+    }
+
+    FieldProxy field_;
+    std::vector<Slot> slots_;
+    std::vector<Entry> entries_;
+    std::size_t key_count_ {0};
+};
+
+//! Make a hash index from the values of a field to the positions of records in an array.
+template <typename FieldProxy>
+auto MakeFieldIndex(const FieldProxy& field,
+                    const std::span<const typename FieldProxy::Struct> objs) {
+    FieldIndex<FieldProxy> index {field};
+    index.Build(objs);
+    return index;
+}
+
+}  // namespace field_access_proxy
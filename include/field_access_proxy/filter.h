@@ -0,0 +1,370 @@
+/**
+ * @file filter.h
+ * @brief Predicates over field proxies that select records in batches.
+ *
+ * @details
+ * Predicates are built with @ref Eq and @ref IsSet and combined with @p &&, @p || and @p !.
+ * Records are evaluated in blocks of 64 into a selection bitmap, one bit per record.
+ *
+ * @par GitHub
+ * https://github.com/Zhuagenborn
+ */
+
+#pragma once
+
+#include "field_access_proxy.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace field_access_proxy {
+
+namespace impl {
+
+//! The number of records evaluated at once, one bit per record in a selection word.
+inline constexpr std::size_t filter_block_size {64};
+
+//! Whether a type is a predicate that evaluates a block of objects into a selection word.
+template <typename T>
+concept IsPredicate = requires(const T pred, const std::span<const typename T::Struct> objs) {
+    { pred.Evaluate(objs) } -> std::same_as<std::uint64_t>;
+};
+
+//! Whether a predicate can be represented as a single mask comparison on a parent field.
+template <typename T>
+concept IsMaskable = requires(const T pred) { pred.AsMask(); };
+
+//! Whether two predicates may be fused into a single mask comparison on the same parent field.
+template <typename Lhs, typename Rhs>
+concept IsFusable = IsMaskable<Lhs> && IsMaskable<Rhs>
+                    && std::same_as<decltype(std::declval<const Lhs&>().AsMask()),
+                                    decltype(std::declval<const Rhs&>().AsMask())>;
+
+//! Get a selection word whose lowest bits are set for each object in a block.
+constexpr std::uint64_t GetBlockMask(const std::size_t count) noexcept {
+    assert(count <= filter_block_size);
+    return count == filter_block_size ? ~std::uint64_t {0} : (std::uint64_t {1} << count) - 1;
+}
+
+//! Get a value of an integral type, a scoped enumeration or @p std::byte with all bits set.
+template <typename Value>
+    requires(!std::same_as<Value, bool>)
+constexpr Value GetAllOnes() noexcept {
+    if constexpr (std::is_enum_v<Value>) {
+        using Integer = std::make_unsigned_t<std::underlying_type_t<Value>>;
+        return static_cast<Value>(std::numeric_limits<Integer>::max());
+    } else {
+        return static_cast<Value>(std::numeric_limits<std::make_unsigned_t<Value>>::max());
+    }
+}
+
+struct Empty {};
+
+//! The fused predicate stored by a conjunction, or nothing if its predicates cannot be fused.
+template <typename Lhs, typename Rhs>
+struct FusedMask {
+    using type = Empty;
+};
+
+template <typename Lhs, typename Rhs>
+    requires IsFusable<Lhs, Rhs>
+struct FusedMask<Lhs, Rhs> {
+    using type = decltype(std::declval<const Lhs&>().AsMask());
+};
+
+}  // namespace impl
+
+/**
+ * @brief A predicate that compares the masked bits of an integral field with expected bits.
+ *
+ * @details
+ * Conditions on bit fields and boolean fields are represented by their parent fields,
+ * so conditions sharing a parent field can be fused into one load, mask and comparison.
+ *
+ * @tparam ParentFieldProxy The integral field proxy (e.g., @p Field) whose bits are compared.
+ */
+template <typename ParentFieldProxy>
+class MaskPredicate {
+public:
+    using Struct = typename ParentFieldProxy::Struct;
+    using Word = typename ParentFieldProxy::Value;
+
+    static_assert(std::integral<Word>);
+
+    /**
+     * @brief Create a new predicate.
+     *
+     * @param parent The integral field proxy.
+     * @param mask The bits to be compared.
+     * @param expected The expected value of the masked bits.
+     */
+    constexpr MaskPredicate(ParentFieldProxy parent, const Word mask,
+                            const Word expected) noexcept :
+        parent_ {std::move(parent)}, mask_ {mask}, expected_ {expected} {}
+
+    //! Evaluate a block of objects into a selection word.
+    std::uint64_t Evaluate(const std::span<const Struct> objs) const noexcept {
+        assert(objs.size() <= impl::filter_block_size);
+        std::uint64_t selection {0};
+        if constexpr (requires {
+                          parent_.GetMember();
+                          parent_.GetEndian();
+                      }) {
+            // The mask is converted to the raw endianness instead of every value,
+            // so the loop is a plain load, mask and comparison that can be vectorized.
+            const auto member {parent_.GetMember()};
+            const auto mask {impl::ConvertEndian(mask_, parent_.GetEndian())};
+            const auto expected {impl::ConvertEndian(expected_, parent_.GetEndian())};
+            for (std::size_t i {0}; i != objs.size(); ++i) {
+                const auto matched {static_cast<Word>(objs[i].*member & mask) == expected};
+                selection |= static_cast<std::uint64_t>(matched) << i;
+            }
+        } else {
+            std::array<Word, impl::filter_block_size> words;
+            const auto block_words {std::span {words}.first(objs.size())};
+            impl::GetColumn(parent_, objs, block_words);
+            for (std::size_t i {0}; i != block_words.size(); ++i) {
+                const auto matched {static_cast<Word>(block_words[i] & mask_) == expected_};
+                selection |= static_cast<std::uint64_t>(matched) << i;
+            }
+        }
+
+        return selection;
+    }
+
+    /**
+     * @brief Merge with another predicate into one that requires both.
+     *
+     * @return
+     * The merged predicate,
+     * or nothing if the predicates are on different fields or their expected bits conflict.
+     */
+    constexpr std::optional<MaskPredicate> TryMerge(const MaskPredicate& other) const noexcept {
+        const auto overlap {static_cast<Word>(mask_ & other.mask_)};
+        if (!impl::IsSameField(parent_, other.parent_) || !IsSatisfiable()
+            || !other.IsSatisfiable() || (expected_ & overlap) != (other.expected_ & overlap)) {
+            return std::nullopt;
+        }
+
+        return MaskPredicate {parent_, static_cast<Word>(mask_ | other.mask_),
+                              static_cast<Word>(expected_ | other.expected_)};
+    }
+
+    constexpr std::optional<MaskPredicate> AsMask() const noexcept {
+        return *this;
+    }
+
+private:
+    //! Whether any value can match, which is not the case if expected bits lie outside the mask.
+    constexpr bool IsSatisfiable() const noexcept {
+        return (expected_ & static_cast<Word>(~mask_)) == 0;
+    }
+
+    ParentFieldProxy parent_;
+    Word mask_;
+    Word expected_;
+};
+
+//! A predicate that compares the value of a field with an expected value.
+template <typename FieldProxy>
+class EqualTo {
+public:
+    using Struct = typename FieldProxy::Struct;
+    using Value = typename FieldProxy::Value;
+
+    constexpr EqualTo(FieldProxy field, Value val) noexcept :
+        field_ {std::move(field)}, val_ {std::move(val)} {}
+
+    //! Evaluate a block of objects into a selection word.
+    std::uint64_t Evaluate(const std::span<const Struct> objs) const noexcept {
+        assert(objs.size() <= impl::filter_block_size);
+        std::uint64_t selection {0};
+        for (std::size_t i {0}; i != objs.size(); ++i) {
+            selection |= static_cast<std::uint64_t>(field_.Get(objs[i]) == val_) << i;
+        }
+
+        return selection;
+    }
+
+private:
+    FieldProxy field_;
+    Value val_;
+};
+
+/**
+ * @brief A predicate that requires both of two predicates.
+ *
+ * @details
+ * If both predicates compare bits of the same parent field, they are fused into one comparison when created.
+ */
+template <typename Lhs, typename Rhs>
+    requires std::same_as<typename Lhs::Struct, typename Rhs::Struct>
+class And {
+public:
+    using Struct = typename Lhs::Struct;
+
+    constexpr And(Lhs lhs, Rhs rhs) noexcept : lhs_ {std::move(lhs)}, rhs_ {std::move(rhs)} {
+        if constexpr (impl::IsFusable<Lhs, Rhs>) {
+            if (const auto lhs_mask {lhs_.AsMask()}, rhs_mask {rhs_.AsMask()};
+                lhs_mask.has_value() && rhs_mask.has_value()) {
+                merged_ = lhs_mask->TryMerge(*rhs_mask);
+            }
+        }
+    }
+
+    //! Evaluate a block of objects into a selection word.
+    std::uint64_t Evaluate(const std::span<const Struct> objs) const noexcept {
+        if constexpr (impl::IsFusable<Lhs, Rhs>) {
+            if (merged_.has_value()) {
+                return merged_->Evaluate(objs);
+            }
+        }
+
+        const auto selection {lhs_.Evaluate(objs)};
+        return selection == 0 ? 0 : selection & rhs_.Evaluate(objs);
+    }
+
+    //! Get the fused predicate, if both predicates have been fused.
+    constexpr auto AsMask() const noexcept
+        requires impl::IsFusable<Lhs, Rhs>
+    {
+        return merged_;
+    }
+
+private:
+    Lhs lhs_;
+    Rhs rhs_;
+    [[no_unique_address]] typename impl::FusedMask<Lhs, Rhs>::type merged_ {};
+};
+
+//! A predicate that requires either of two predicates.
+template <typename Lhs, typename Rhs>
+    requires std::same_as<typename Lhs::Struct, typename Rhs::Struct>
+class Or {
+public:
+    using Struct = typename Lhs::Struct;
+
+    constexpr Or(Lhs lhs, Rhs rhs) noexcept : lhs_ {std::move(lhs)}, rhs_ {std::move(rhs)} {}
+
+    //! Evaluate a block of objects into a selection word.
+    std::uint64_t Evaluate(const std::span<const Struct> objs) const noexcept {
+        const auto selection {lhs_.Evaluate(objs)};
+        const auto all {impl::GetBlockMask(objs.size())};
+        return selection == all ? all : selection | rhs_.Evaluate(objs);
+    }
+
+private:
+    Lhs lhs_;
+    Rhs rhs_;
+};
+
+//! A predicate that negates another predicate.
+template <typename Predicate>
+class Not {
+public:
+    using Struct = typename Predicate::Struct;
+
+    explicit constexpr Not(Predicate pred) noexcept : pred_ {std::move(pred)} {}
+
+    //! Evaluate a block of objects into a selection word.
+    std::uint64_t Evaluate(const std::span<const Struct> objs) const noexcept {
+        return ~pred_.Evaluate(objs) & impl::GetBlockMask(objs.size());
+    }
+
+private:
+    Predicate pred_;
+};
+
+template <impl::IsPredicate Lhs, impl::IsPredicate Rhs>
+constexpr And<Lhs, Rhs> operator&&(Lhs lhs, Rhs rhs) noexcept {
+    return {std::move(lhs), std::move(rhs)};
+}
+
+template <impl::IsPredicate Lhs, impl::IsPredicate Rhs>
+constexpr Or<Lhs, Rhs> operator||(Lhs lhs, Rhs rhs) noexcept {
+    return {std::move(lhs), std::move(rhs)};
+}
+
+template <impl::IsPredicate Predicate>
+constexpr Not<Predicate> operator!(Predicate pred) noexcept {
+    return Not<Predicate> {std::move(pred)};
+}
+
+/**
+ * @brief Make a predicate that compares the value of a field with an expected value.
+ *
+ * @details
+ * Conditions on integral fields, bit fields and boolean fields become mask comparisons on their parent fields.
+ *
+ * @param field A field proxy (e.g., @p Field, @p BitField or @p BoolField).
+ * @param val The expected value.
+ */
+template <typename FieldProxy>
+constexpr auto Eq(const FieldProxy& field, const typename FieldProxy::Value& val) noexcept {
+    using Value = typename FieldProxy::Value;
+    if constexpr (requires { field.GetParent(); }) {
+        using ParentFieldProxy = std::remove_cvref_t<decltype(field.GetParent())>;
+        using Word = typename ParentFieldProxy::Value;
+        Word mask {0};
+        if constexpr (std::same_as<Value, bool>) {
+            mask = field.Insert(Word {0}, true);
+        } else {
+            mask = field.Insert(Word {0}, impl::GetAllOnes<Value>());
+        }
+
+        if (const auto expected {field.Insert(Word {0}, val)}; field.Extract(expected) == val) {
+            return MaskPredicate<ParentFieldProxy> {field.GetParent(), mask, expected};
+        } else {
+            // The value does not fit into the bit field, so nothing can be selected.
+            return MaskPredicate<ParentFieldProxy> {field.GetParent(), Word {0}, Word {1}};
+        }
+    } else if constexpr (std::integral<Value>) {
+        return MaskPredicate<FieldProxy> {field, impl::GetAllOnes<Value>(), val};
+    } else {
+        return EqualTo<FieldProxy> {field, val};
+    }
+}
+
+//! Make a predicate that checks whether a boolean field is set.
+template <typename FieldProxy>
+    requires std::same_as<typename FieldProxy::Value, bool>
+constexpr auto IsSet(const FieldProxy& field) noexcept {
+    return Eq(field, true);
+}
+
+//! Get the number of selection words for a number of records.
+constexpr std::size_t GetSelectionSize(const std::size_t count) noexcept {
+    return (count + impl::filter_block_size - 1) / impl::filter_block_size;
+}
+
+/**
+ * @brief Evaluate a predicate over an array of objects into a selection bitmap.
+ *
+ * @details
+ * Bit @p i of word @p i / 64 is set if object @p i is selected.
+ * Bits past the last object are cleared.
+ *
+ * @param pred The predicate.
+ * @param objs The objects.
+ * @param selection The output bitmap, which must contain at least @ref GetSelectionSize words.
+ */
+template <impl::IsPredicate Predicate>
+void Filter(const Predicate& pred, const std::span<const typename Predicate::Struct> objs,
+            const std::span<std::uint64_t> selection) noexcept {
+    assert(selection.size() >= GetSelectionSize(objs.size()));
+    for (std::size_t begin {0}; begin < objs.size(); begin += impl::filter_block_size) {
+        const auto count {std::min(impl::filter_block_size, objs.size() - begin)};
+        selection[begin / impl::filter_block_size] = pred.Evaluate(objs.subspan(begin, count));
+    }
+}
+
+}  // namespace field_access_proxy
@@ -0,0 +1,159 @@
+/**
+ * @file mapped_file.h
+ * @brief A read-only memory-mapped file whose records can be accessed through field proxies.
+ *
+ * @details
+ * Records are accessed directly on mapped pages, so large files need not be copied into memory.
+ * It is only available on POSIX systems.
+ *
+ * @par GitHub
+ * https://github.com/Zhuagenborn
+ */
+
+#pragma once
+
+#include "field_access_proxy.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace field_access_proxy {
+
+//! A read-only memory-mapped file.
+class MappedFile {
+public:
+    //! The expected access pattern, used as a hint for the kernel.
+    enum class Access { Normal, Sequential, Random };
+
+    /**
+     * @brief Map a file into memory.
+     *
+     * @param path The file path.
+     * @param access The expected access pattern, the default is sequential.
+     * @return The mapped file, or the system error if the file cannot be mapped.
+     */
+    static std::expected<MappedFile, std::error_code> Open(
+        const std::filesystem::path& path, const Access access = Access::Sequential) noexcept {
+        const auto fd {::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (fd == -1) {
+            return std::unexpected {std::error_code {errno, std::system_category()}};
+        }
+
+        struct stat status {};
+        if (::fstat(fd, &status) == -1) {
+            const std::error_code error {errno, std::system_category()};
+            ::close(fd);
+            return std::unexpected {error};
+        }
+
+        const auto size {static_cast<std::size_t>(status.st_size)};
+        if (size == 0) {
+            ::close(fd);
+            return MappedFile {nullptr, 0};
+        }
+
+        const auto data {::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+        if (data == MAP_FAILED) {
+            const std::error_code error {errno, std::system_category()};
+            ::close(fd);
+            return std::unexpected {error};
+        }
+
+        // The mapping keeps the file referenced, so the descriptor is no longer needed.
+        ::close(fd);
+
+        // The hint is only advisory, so its failure is ignored.
+        ::madvise(data, size, ToAdvice(access));
+        return MappedFile {data, size};
+    }
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept :
+        data_ {std::exchange(other.data_, nullptr)}, size_ {std::exchange(other.size_, 0)} {}
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+
+        return *this;
+    }
+
+    ~MappedFile() noexcept {
+        Unmap();
+    }
+
+    //! Get all bytes of the file.
+    std::span<const std::byte> GetBytes() const noexcept {
+        return {static_cast<const std::byte*>(data_), size_};
+    }
+
+    /**
+     * @brief Get the file as an array of fixed-size records.
+     *
+     * @details
+     * Trailing bytes that cannot form a complete record are ignored.
+     * The array can be used with batch operations such as @ref ExtractColumn.
+     */
+    template <typename Struct>
+        requires std::is_trivially_copyable_v<Struct>
+    std::span<const Struct> GetRecords() const noexcept {
+        assert(reinterpret_cast<std::uintptr_t>(data_) % alignof(Struct) == 0);
+        return {static_cast<const Struct*>(data_), size_ / sizeof(Struct)};
+    }
+
+    //! Get the file as back-to-back records, each followed by its flexible array elements.
+    template <typename FlexibleArrayFieldProxy>
+    auto GetRecordStream(const FlexibleArrayFieldProxy& field) const noexcept {
+        return MakeRecordStream(GetBytes(), field);
+    }
+
+private:
+    MappedFile(void* const data, const std::size_t size) noexcept : data_ {data}, size_ {size} {}
+
+    static constexpr int ToAdvice(const Access access) noexcept {
+        switch (access) {
+            case Access::Sequential: {
+                return MADV_SEQUENTIAL;
+            }
+            case Access::Random: {
+                return MADV_RANDOM;
+            }
+            default: {
+                return MADV_NORMAL;
+            }
+        }
+    }
+
+    void Unmap() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    void* data_ {nullptr};
+    std::size_t size_ {0};
+};
+
+}  // namespace field_access_proxy
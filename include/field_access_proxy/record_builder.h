@@ -0,0 +1,210 @@
+/**
+ * @file record_builder.h
+ * @brief Building records with flexible arrays in exactly sized allocations.
+ *
+ * @par GitHub
+ * https://github.com/Zhuagenborn
+ */
+
+#pragma once
+
+#include "field_access_proxy.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace field_access_proxy {
+
+/**
+ * @brief An owned record allocated from a memory resource, including its flexible array elements.
+ *
+ * @tparam Struct The structure type.
+ */
+template <typename Struct>
+    requires std::is_trivially_destructible_v<Struct>
+class OwnedRecord {
+public:
+    OwnedRecord() noexcept = default;
+
+    /**
+     * @brief Take the ownership of a record.
+     *
+     * @param obj The record object.
+     * @param size The number of allocated bytes.
+     * @param resource The memory resource the record was allocated from.
+     */
+    OwnedRecord(Struct* const obj, const std::size_t size,
+                std::pmr::memory_resource* const resource) noexcept :
+        obj_ {obj}, size_ {size}, resource_ {resource} {
+        assert(obj_ == nullptr || resource_ != nullptr);
+    }
+
+    OwnedRecord(const OwnedRecord&) = delete;
+
+    OwnedRecord(OwnedRecord&& other) noexcept :
+        obj_ {std::exchange(other.obj_, nullptr)},
+        size_ {std::exchange(other.size_, 0)},
+        resource_ {std::exchange(other.resource_, nullptr)} {}
+
+    OwnedRecord& operator=(const OwnedRecord&) = delete;
+
+    OwnedRecord& operator=(OwnedRecord&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            obj_ = std::exchange(other.obj_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            resource_ = std::exchange(other.resource_, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~OwnedRecord() noexcept {
+        Reset();
+    }
+
+    Struct& operator*() const noexcept {
+        assert(obj_ != nullptr);
+        return *obj_;
+    }
+
+    Struct* operator->() const noexcept {
+        assert(obj_ != nullptr);
+        return obj_;
+    }
+
+    Struct* Get() const noexcept {
+        return obj_;
+    }
+
+    explicit operator bool() const noexcept {
+        return obj_ != nullptr;
+    }
+
+    //! Get the number of allocated bytes, including all flexible array elements.
+    std::size_t GetByteSize() const noexcept {
+        return size_;
+    }
+
+    //! Get all bytes of the record.
+    std::span<const std::byte> GetBytes() const noexcept {
+        return {reinterpret_cast<const std::byte*>(obj_), size_};
+    }
+
+    //! Release the ownership of the record without deallocating it.
+    Struct* Release() noexcept {
+        size_ = 0;
+        resource_ = nullptr;
+        return std::exchange(obj_, nullptr);
+    }
+
+    //! Deallocate the record.
+    void Reset() noexcept {
+        if (obj_ != nullptr) {
+            std::destroy_at(obj_);
+            resource_->deallocate(obj_, size_, alignof(Struct));
+            obj_ = nullptr;
+            size_ = 0;
+            resource_ = nullptr;
+        }
+    }
+
+private:
+    Struct* obj_ {nullptr};
+    std::size_t size_ {0};
+    std::pmr::memory_resource* resource_ {nullptr};
+};
+
+/**
+ * @brief A builder that creates records with flexible arrays in exactly sized allocations.
+ *
+ * @details
+ * The size of a record is computed from the element type, the number of elements
+ * and the fixed count of its flexible array field.
+ * Each record costs a single allocation from a memory resource,
+ * which can be an arena such as @p std::pmr::monotonic_buffer_resource.
+ *
+ * @tparam FlexibleArrayFieldProxy The flexible array field proxy (e.g., @p FlexibleArrayField) of records.
+ */
+template <typename FlexibleArrayFieldProxy>
+class RecordBuilder {
+public:
+    using Struct = typename FlexibleArrayFieldProxy::Struct;
+    using Element = typename FlexibleArrayFieldProxy::Element;
+
+    static_assert(std::is_trivially_copyable_v<Element>);
+
+    /**
+     * @brief Create a new record builder.
+     *
+     * @param field The flexible array field proxy of records.
+     * @param resource The memory resource records are allocated from, the default is the default memory resource.
+     */
+    explicit RecordBuilder(
+        FlexibleArrayFieldProxy field,
+        std::pmr::memory_resource* const resource = std::pmr::get_default_resource()) noexcept :
+        field_ {std::move(field)}, resource_ {resource} {
+        assert(resource_ != nullptr);
+    }
+
+    /**
+     * @brief Build a new record with flexible array elements.
+     *
+     * @details
+     * The record is value-initialized, and then its elements and count field are set.
+     *
+     * @exception std::length_error The count field cannot represent the number of elements.
+     * @exception std::bad_alloc The memory resource fails to allocate the record.
+     */
+    OwnedRecord<Struct> Build(const std::span<const Element> elems) const {
+        if (elems.size() > field_.GetMaxCount()) {
+            throw std::length_error {"The count field cannot represent the number of elements"};
+        }
+
+        const auto size {field_.GetByteSize(elems.size())};
+        const auto obj {::new (resource_->allocate(size, alignof(Struct))) Struct {}};
+        field_.SetAll(*obj, elems, true);
+        return {obj, size, resource_};
+    }
+
+    /**
+     * @brief Copy a record with its flexible array elements, such as one from a @ref RecordStream.
+     *
+     * @exception std::bad_alloc The memory resource fails to allocate the record.
+     */
+    OwnedRecord<Struct> Copy(const Struct& src) const
+        requires std::is_trivially_copyable_v<Struct>
+    {
+        const auto size {field_.GetByteSize(src)};
+        const auto mem {resource_->allocate(size, alignof(Struct))};
+        std::memcpy(mem, std::addressof(src), size);
+        return {std::launder(static_cast<Struct*>(mem)), size, resource_};
+    }
+
+    //! Get the memory resource records are allocated from.
+    std::pmr::memory_resource* GetResource() const noexcept {
+        return resource_;
+    }
+
+private:
+    FlexibleArrayFieldProxy field_;
+    std::pmr::memory_resource* resource_;
+};
+
+//! Make a builder that creates records with flexible arrays in exactly sized allocations.
+template <typename FlexibleArrayFieldProxy>
+auto MakeRecordBuilder(
+    const FlexibleArrayFieldProxy& field,
+    std::pmr::memory_resource* const resource = std::pmr::get_default_resource()) noexcept {
+    return RecordBuilder<FlexibleArrayFieldProxy> {field, resource};
+}
+
+}  // namespace field_access_proxy
@@ -0,0 +1,225 @@
+/**
+ * @file record_pool.h
+ * @brief A pool allocating short-lived records with flexible arrays in batches.
+ *
+ * @par GitHub
+ * https://github.com/Zhuagenborn
+ */
+
+#pragma once
+
+#include "record_builder.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace field_access_proxy {
+
+/**
+ * @brief A memory resource for records with flexible arrays, backed by monotonic arenas.
+ *
+ * @details
+ * Records are rounded up to size classes whose capacities are powers of two elements of the flexible array field.
+ * Deallocated records are kept in per-class free lists and reused by later allocations of the same class.
+ * Other memory is bumped from arena chunks requested from an upstream resource,
+ * which are kept by @ref Reset, so a warmed-up pool never calls the upstream resource again.
+ *
+ * Requests for stricter alignments than records need are forwarded to the upstream resource.
+ *
+ * The pool can be used with @ref RecordBuilder. It is not thread-safe.
+ *
+ * @tparam FlexibleArrayFieldProxy The flexible array field proxy (e.g., @p FlexibleArrayField) of records.
+ */
+template <typename FlexibleArrayFieldProxy>
+class RecordPool : public std::pmr::memory_resource {
+public:
+    using Struct = typename FlexibleArrayFieldProxy::Struct;
+    using Element = typename FlexibleArrayFieldProxy::Element;
+
+    //! The number of size classes. Larger records are bumped from arenas but never reused.
+    static constexpr std::size_t class_count {48};
+
+    //! The default size of an arena chunk in bytes.
+    static constexpr std::size_t default_chunk_size {64 * 1024};
+
+    /**
+     * @brief Create a new record pool.
+     *
+     * @param field The flexible array field proxy of records.
+     * @param chunk_size The minimum size of an arena chunk in bytes.
+     * @param upstream The memory resource arena chunks are allocated from, the default is the default memory resource.
+     */
+    explicit RecordPool(
+        FlexibleArrayFieldProxy field, const std::size_t chunk_size = default_chunk_size,
+        std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()) noexcept :
+        field_ {std::move(field)}, chunk_size_ {chunk_size}, upstream_ {upstream} {
+        assert(upstream_ != nullptr);
+    }
+
+    RecordPool(const RecordPool&) = delete;
+
+    RecordPool& operator=(const RecordPool&) = delete;
+
+    ~RecordPool() noexcept override {
+        for (const auto& chunk : chunks_) {
+            upstream_->deallocate(chunk.data, chunk.size, alignment);
+        }
+    }
+
+    /**
+     * @brief Free all records of the current batch at once.
+     *
+     * @details
+     * Arena chunks are kept for the next batch.
+     * All records allocated from the pool become invalid,
+     * so records owned by @ref OwnedRecord must be destroyed or released before resetting.
+     */
+    void Reset() noexcept {
+        curr_chunk_ = 0;
+        offset_ = 0;
+        free_lists_.fill(nullptr);
+    }
+
+    /**
+     * @brief Allocate arena chunks in advance.
+     *
+     * @exception std::bad_alloc The upstream resource fails to allocate a chunk.
+     */
+    void Reserve(const std::size_t size) {
+        std::size_t reserved {0};
+        for (const auto& chunk : chunks_) {
+            reserved += chunk.size;
+        }
+
+        if (reserved < size) {
+            AddChunk(size - reserved);
+        }
+    }
+
+    //! Get the size class of a record in bytes.
+    std::size_t GetSizeClass(const std::size_t size) const noexcept {
+        const auto min_size {field_.GetByteSize(0)};
+        if (size <= min_size) {
+            return 0;
+        }
+
+        // The estimate is close to the smallest class that can hold the record,
+        // but padding may make a neighbouring class the exact one.
+        auto cls {std::min(GetCapacityClass((size - min_size) / sizeof(Element)), class_count)};
+        while (cls != 0 && GetClassByteSize(cls - 1) >= size) {
+            --cls;
+        }
+
+        while (cls != class_count && GetClassByteSize(cls) < size) {
+            ++cls;
+        }
+
+        return cls;
+    }
+
+    //! Get the number of bytes allocated for a size class.
+    std::size_t GetClassByteSize(const std::size_t cls) const noexcept {
+        assert(cls < class_count);
+        const std::size_t capacity {cls == 0 ? 0 : std::size_t {1} << (cls - 1)};
+        return AlignUp(field_.GetByteSize(capacity));
+    }
+
+private:
+    //! A deallocated record in a free list.
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct Chunk {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t alignment {std::max(alignof(Struct), alignof(FreeBlock))};
+
+    static constexpr std::size_t AlignUp(const std::size_t size) noexcept {
+        return std::max((size + alignment - 1) / alignment * alignment, sizeof(FreeBlock));
+    }
+
+    //! Get the smallest size class whose capacity is not less than the number of elements.
+    static constexpr std::size_t GetCapacityClass(const std::size_t count) noexcept {
+        return count == 0 ? 0 : static_cast<std::size_t>(std::bit_width(count - 1)) + 1;
+    }
+
+    void* do_allocate(const std::size_t size, const std::size_t align) override {
+        if (align > alignment) {
+            // Arena chunks cannot serve stricter alignments.
+            return upstream_->allocate(size, align);
+        }
+
+        const auto cls {GetSizeClass(size)};
+        if (cls == class_count) {
+            return Bump(AlignUp(size));
+        } else if (const auto block {free_lists_[cls]}; block != nullptr) {
+            free_lists_[cls] = block->next;
+            return block;
+        } else {
+            return Bump(GetClassByteSize(cls));
+        }
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size,
+                       const std::size_t align) noexcept override {
+        if (align > alignment) {
+            upstream_->deallocate(ptr, size, align);
+        } else if (const auto cls {GetSizeClass(size)}; cls != class_count) {
+            free_lists_[cls] = ::new (ptr) FreeBlock {free_lists_[cls]};
+        }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    void* Bump(const std::size_t size) {
+        for (; curr_chunk_ != chunks_.size(); ++curr_chunk_, offset_ = 0) {
+            if (const auto& chunk {chunks_[curr_chunk_]}; chunk.size - offset_ >= size) {
+                const auto ptr {chunk.data + offset_};
+                offset_ += size;
+                return ptr;
+            }
+        }
+
+        AddChunk(size);
+        curr_chunk_ = chunks_.size() - 1;
+        offset_ = size;
+        return chunks_.back().data;
+    }
+
+    void AddChunk(const std::size_t min_size) {
+        const auto size {AlignUp(std::max(min_size, chunk_size_))};
+        chunks_.reserve(chunks_.size() + 1);
+        chunks_.push_back({static_cast<std::byte*>(upstream_->allocate(size, alignment)), size});
+    }
+
+    FlexibleArrayFieldProxy field_;
+    std::size_t chunk_size_;
+    std::pmr::memory_resource* upstream_;
+    std::vector<Chunk> chunks_;
+    std::size_t curr_chunk_ {0};
+    std::size_t offset_ {0};
+    std::array<FreeBlock*, class_count> free_lists_ {};
+};
+
+//! Make a memory resource for records with flexible arrays, backed by monotonic arenas.
+template <typename FlexibleArrayFieldProxy>
+auto MakeRecordPool(
+    const FlexibleArrayFieldProxy& field,
+    const std::size_t chunk_size = RecordPool<FlexibleArrayFieldProxy>::default_chunk_size,
+    std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()) noexcept {
+    return RecordPool<FlexibleArrayFieldProxy> {field, chunk_size, upstream};
+}
+
+}  // namespace field_access_proxy
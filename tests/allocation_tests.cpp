@@ -0,0 +1,308 @@
+/**
+ * @file allocation_tests.cpp
+ * @brief Tests that hot operations of proxies never allocate memory from the heap.
+ *
+ * @details
+ * The global allocation functions are replaced to count allocations,
+ * so these tests are built as a separate executable.
+ */
+
+#include "endian.h"
+#include "field_access_proxy/field_access_proxy.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <span>
+#include <string>
+#include <tuple>
+
+using namespace field_access_proxy;
+
+namespace {
+
+std::size_t allocation_count {0};
+
+void* Allocate(const std::size_t size) {
+    ++allocation_count;
+    if (const auto ptr {std::malloc(size == 0 ? 1 : size)}; ptr != nullptr) {
+        return ptr;
+    } else {
+        throw std::bad_alloc {};
+    }
+}
+
+void* Allocate(const std::size_t size, const std::align_val_t align) {
+    ++allocation_count;
+    const auto alignment {static_cast<std::size_t>(align)};
+    // The size passed to "std::aligned_alloc" must be a non-zero multiple of the alignment.
+    const auto block_count {std::max((size + alignment - 1) / alignment, std::size_t {1})};
+    if (const auto ptr {std::aligned_alloc(alignment, block_count * alignment)}; ptr != nullptr) {
+        return ptr;
+    } else {
+        throw std::bad_alloc {};
+    }
+}
+
+//! Count the heap allocations made during its lifetime.
+class AllocationCounter {
+public:
+    AllocationCounter() noexcept : begin_ {allocation_count} {}
+
+    std::size_t GetCount() const noexcept {
+        return allocation_count - begin_;
+    }
+
+private:
+    std::size_t begin_;
+};
+
+using String = std::array<char, 4>;
+
+#pragma pack(push, 1)
+
+struct Item {
+    String msg {'1', '2', '3', '4'};
+
+    constexpr bool operator==(const Item&) const noexcept = default;
+};
+
+struct Packet {
+    static constexpr std::size_t max_items {10};
+
+    std::uint16_t major_minor_verions {0x1234};
+    String type {'t', 'y', 'p', 'e'};
+    std::size_t opposite_endian_item_count {std::byteswap(max_items)};
+    Item first_item[1];
+};
+
+//! Simulate a flexible array with additional elements.
+struct PacketItems : Packet {
+    Item remain_items[max_items - 1];
+};
+
+#pragma pack(pop)
+
+namespace vt {
+
+constexpr auto version {MakeField("The version", &Packet::major_minor_verions)};
+constexpr auto type {MakeField("The type", &Packet::type)};
+constexpr auto opposite_endian_item_count {
+    MakeField("The number of items", &Packet::opposite_endian_item_count, GetOppositeEndian())};
+constexpr auto static_opposite_endian_item_count {
+    MakeStaticField<&Packet::opposite_endian_item_count, "The number of items",
+                    GetOppositeEndian()>()};
+
+constexpr auto major_version {MakeBitField("The major version", version, CHAR_BIT, CHAR_BIT)};
+constexpr auto minor_version {MakeBitField("The minor version", version, 0, CHAR_BIT)};
+constexpr auto static_major_version {
+    MakeBitField<CHAR_BIT, CHAR_BIT, std::uint8_t>("The major version", version)};
+
+constexpr auto is_version_first_bit_set {
+    MakeBoolField("Whether the first bit of the version is set", version, 0)};
+constexpr auto static_is_version_first_bit_set {
+    MakeBoolField<0>("Whether the first bit of the version is set", version)};
+
+constexpr auto flexible_items {
+    MakeFlexibleArrayField("Items", &Packet::first_item, opposite_endian_item_count)};
+
+}  // namespace vt
+
+}  // namespace
+
+void* operator new(const std::size_t size) {
+    return Allocate(size);
+}
+
+void* operator new[](const std::size_t size) {
+    return Allocate(size);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t align) {
+    return Allocate(size, align);
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t align) {
+    return Allocate(size, align);
+}
+
+void operator delete(void* const ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* const ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* const ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* const ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* const ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+TEST(Allocation, Counter) {
+    const AllocationCounter counter;
+    delete new int {0};
+    EXPECT_EQ(counter.GetCount(), 1);
+}
+
+TEST(Allocation, Field) {
+    PacketItems pkg_items;
+    auto& pkg {static_cast<Packet&>(pkg_items)};
+
+    const AllocationCounter counter;
+    vt::version.Set(pkg, vt::version.Get(pkg));
+    vt::type.Set(pkg, vt::type.Get(pkg));
+    vt::opposite_endian_item_count.Set(pkg, vt::opposite_endian_item_count.Get(pkg));
+    vt::static_opposite_endian_item_count.Set(pkg, vt::static_opposite_endian_item_count.Get(pkg));
+    EXPECT_EQ(counter.GetCount(), 0);
+}
+
+TEST(Allocation, BitField) {
+    PacketItems pkg_items;
+    auto& pkg {static_cast<Packet&>(pkg_items)};
+
+    const AllocationCounter counter;
+    vt::major_version.Set(pkg, vt::major_version.Get(pkg));
+    vt::static_major_version.Set(pkg, vt::static_major_version.Get(pkg));
+    vt::is_version_first_bit_set.Set(pkg, vt::is_version_first_bit_set.Get(pkg));
+    vt::static_is_version_first_bit_set.Set(pkg, vt::static_is_version_first_bit_set.Get(pkg));
+
+    const auto versions {MakeBitFieldGroup(vt::major_version, vt::minor_version)};
+    versions.Set(pkg, versions.Get(pkg));
+    EXPECT_EQ(counter.GetCount(), 0);
+}
+
+TEST(Allocation, FlexibleArrayField) {
+    PacketItems pkg_items;
+    auto& pkg {static_cast<Packet&>(pkg_items)};
+
+    const AllocationCounter counter;
+    const auto items {vt::flexible_items.View(pkg)};
+    EXPECT_EQ(items.size(), Packet::max_items);
+    vt::flexible_items.SetAll(pkg, items);
+    vt::flexible_items.SetAt(pkg, 0, vt::flexible_items.GetAt(pkg, 1));
+    EXPECT_TRUE(vt::flexible_items.Validate(pkg, sizeof(PacketItems)).has_value());
+    EXPECT_EQ(vt::flexible_items.GetByteSize(pkg), sizeof(PacketItems));
+    EXPECT_EQ(counter.GetCount(), 0);
+}
+
+TEST(Allocation, ByteBuffer) {
+    const PacketItems pkg_items;
+    std::array<std::byte, sizeof(Packet) + 1> buffer;
+    const auto bytes {std::span {buffer}.subspan(1)};
+    std::memcpy(bytes.data(), &pkg_items, sizeof(Packet));
+    const std::span<const std::byte> const_bytes {bytes};
+
+    const AllocationCounter counter;
+    vt::version.Set(bytes, vt::version.Get(const_bytes));
+    vt::opposite_endian_item_count.Set(bytes, vt::opposite_endian_item_count.Get(const_bytes));
+    vt::major_version.Set(bytes, vt::major_version.Get(const_bytes));
+    vt::static_major_version.Set(bytes, vt::static_major_version.Get(const_bytes));
+    EXPECT_EQ(counter.GetCount(), 0);
+}
+
+TEST(Allocation, Column) {
+    std::array<Packet, 300> pkgs;
+    std::array<std::size_t, pkgs.size()> counts;
+    std::array<std::uint8_t, pkgs.size()> major_versions;
+
+    const AllocationCounter counter;
+    ExtractColumn(vt::opposite_endian_item_count, std::span<const Packet> {pkgs},
+                  std::span {counts});
+    ScatterColumn(vt::opposite_endian_item_count, std::span<const std::size_t> {counts},
+                  std::span {pkgs});
+    ExtractColumn(vt::static_major_version, std::span<const Packet> {pkgs},
+                  std::span {major_versions});
+    ScatterColumn(vt::static_major_version, std::span<const std::uint8_t> {major_versions},
+                  std::span {pkgs});
+    EXPECT_EQ(counter.GetCount(), 0);
+}
+
+TEST(Allocation, RecordStream) {
+    const PacketItems pkg_items;
+    const std::span bytes {reinterpret_cast<const std::byte*>(&pkg_items), sizeof(pkg_items)};
+
+    const AllocationCounter counter;
+    std::size_t count {0};
+    for (const auto& record : MakeRecordStream(bytes, vt::flexible_items)) {
+        count += record.elems.size();
+    }
+
+    EXPECT_EQ(count, Packet::max_items);
+    EXPECT_EQ(counter.GetCount(), 0);
+}
+
+TEST(Allocation, FormatTo) {
+    const PacketItems pkg_items;
+    const auto& pkg {static_cast<const Packet&>(pkg_items)};
+    const auto fields {std::make_tuple(vt::version, vt::opposite_endian_item_count,
+                                       vt::major_version, vt::is_version_first_bit_set)};
+    std::array<char, 256> buffer;
+
+    const AllocationCounter counter;
+    vt::version.FormatTo(buffer.data(), pkg);
+    vt::static_major_version.FormatTo(buffer.data(), pkg);
+    FormatFields(std::span {buffer}, pkg, fields);
+    EXPECT_EQ(counter.GetCount(), 0);
+}
+
+//! Operations that allocate by design, whose costs are recorded in the test report.
+TEST(Allocation, AllocatingOperations) {
+    const PacketItems pkg_items;
+    const auto& pkg {static_cast<const Packet&>(pkg_items)};
+    {
+        // A vector of elements is allocated once.
+        const AllocationCounter counter;
+        const auto items {vt::flexible_items.GetAll(pkg)};
+        const auto count {counter.GetCount()};
+        RecordProperty("GetAll", static_cast<int>(count));
+        EXPECT_EQ(count, 1);
+    }
+    {
+        // A string is allocated unless it fits in the small string buffer.
+        const AllocationCounter counter;
+        const auto str {vt::version.Format(pkg)};
+        const auto count {counter.GetCount()};
+        RecordProperty("Format", static_cast<int>(count));
+        EXPECT_LE(count, 1);
+    }
+    {
+        // Once the buffer has grown large enough, formatting into it does not allocate.
+        std::string buffer;
+        const auto fields {std::make_tuple(vt::version, vt::major_version)};
+        FormatFields(buffer, pkg, fields);
+
+        const AllocationCounter counter;
+        buffer.clear();
+        FormatFields(buffer, pkg, fields);
+        const auto count {counter.GetCount()};
+        RecordProperty("FormatFields with a reused buffer", static_cast<int>(count));
+        EXPECT_EQ(count, 0);
+    }
+}
@@ -0,0 +1,67 @@
+#include "field_access_proxy/byte_swap.h"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace field_access_proxy;
+
+namespace {
+
+template <typename T>
+void ExpectByteSwapColumn() {
+    for (std::size_t size {0}; size != 100; ++size) {
+        std::vector<T> vals(size);
+        for (std::size_t i {0}; i != size; ++i) {
+            vals[i] = static_cast<T>(0x0123456789ABCDEF * (i + 1));
+        }
+
+        auto swapped {vals};
+        ByteSwapColumn<T>(swapped);
+        for (std::size_t i {0}; i != size; ++i) {
+            EXPECT_EQ(swapped[i], std::byteswap(vals[i]));
+        }
+    }
+}
+
+//! Compare a byte shuffling kernel with the scalar loop, including tails shorter than a vector.
+template <typename T>
+void ExpectByteSwapKernel(const impl::SimdLevel level) {
+    for (std::size_t size {0}; size != 100; ++size) {
+        std::vector<T> vals(size);
+        for (std::size_t i {0}; i != size; ++i) {
+            vals[i] = static_cast<T>(0x0123456789ABCDEF * (i + 1));
+        }
+
+        auto expected {vals};
+        impl::ByteSwapColumnWith<T>(expected, impl::SimdLevel::Scalar);
+        impl::ByteSwapColumnWith<T>(vals, level);
+        EXPECT_EQ(vals, expected) << "Size " << size;
+    }
+}
+
+}  // namespace
+
+TEST(ByteSwap, Kernels) {
+    using impl::SimdLevel;
+    for (const auto level : {SimdLevel::Scalar, SimdLevel::Ssse3, SimdLevel::Avx2}) {
+        if (level > impl::GetSimdLevel()) {
+            // The running processor does not support the instruction set extensions.
+            continue;
+        }
+
+        ExpectByteSwapKernel<std::uint16_t>(level);
+        ExpectByteSwapKernel<std::int32_t>(level);
+        ExpectByteSwapKernel<std::uint64_t>(level);
+    }
+}
+
+TEST(ByteSwap, Column) {
+    ExpectByteSwapColumn<std::uint8_t>();
+    ExpectByteSwapColumn<std::uint16_t>();
+    ExpectByteSwapColumn<std::int32_t>();
+    ExpectByteSwapColumn<std::uint64_t>();
+}
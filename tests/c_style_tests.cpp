@@ -8,10 +8,18 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace field_access_proxy;
 
@@ -61,30 +69,51 @@ std::string FormatItems(const FlexibleArray<Item>&) noexcept {
 
 namespace vt {
 
-const auto type {MakeField("The type", &Packet::type,
-                           [](const Packet&, const String& type) { return fm::FormatType(type); })};
+constexpr auto type {
+    MakeField("The type", &Packet::type,
+              [](const Packet&, const String& type) { return fm::FormatType(type); })};
 
-const auto version {MakeField("The version", &Packet::major_minor_verions)};
-const auto opposite_endian_item_count {
+constexpr auto version {MakeField("The version", &Packet::major_minor_verions)};
+constexpr auto opposite_endian_item_count {
     MakeField("The number of items", &Packet::opposite_endian_item_count, GetOppositeEndian())};
-const auto first_item {MakeField("The first item", &Packet::first_item)};
+constexpr auto static_endian_item_count {
+    MakeField<GetOppositeEndian()>("The number of items", &Packet::opposite_endian_item_count)};
+constexpr auto first_item {MakeField("The first item", &Packet::first_item)};
 
-const auto major_version {MakeBitField("The major version", version, CHAR_BIT, CHAR_BIT)};
-const auto minor_version {
+constexpr auto major_version {MakeBitField("The major version", version, CHAR_BIT, CHAR_BIT)};
+constexpr auto minor_version {
     MakeBitField("The minor version", version, 0, CHAR_BIT, fm::FormatVersion)};
 
-const auto is_version_first_bit_set {
+constexpr auto is_version_first_bit_set {
     MakeBoolField("Whether the first bit of the version is set", version, 0)};
 
-const auto flexible_items {MakeFlexibleArrayField(
+constexpr auto flexible_items {MakeFlexibleArrayField(
     "Items", &Packet::first_item, opposite_endian_item_count, 0,
     [](const Packet&, const FlexibleArray<Item>& items) { return fm::FormatItems(items); })};
 
-const auto fixed_flexible_items {
+constexpr auto fixed_flexible_items {
     MakeFlexibleArrayField("Items", &Packet::first_item, MakeConstant(Packet::max_items))};
 
+constexpr auto static_version {MakeStaticField<&Packet::major_minor_verions, "The version">()};
+constexpr auto static_opposite_endian_item_count {
+    MakeStaticField<&Packet::opposite_endian_item_count, "The number of items",
+                    GetOppositeEndian()>()};
+
+constexpr auto static_major_version {
+    MakeBitField<CHAR_BIT, CHAR_BIT, std::uint8_t>("The major version", static_version)};
+constexpr auto static_minor_version {MakeBitField<0, CHAR_BIT>("The minor version", version)};
+constexpr auto static_is_version_first_bit_set {
+    MakeBoolField<0>("Whether the first bit of the version is set", static_version)};
+
+static_assert(std::is_empty_v<decltype(static_version)>);
+
 }  // namespace vt
 
+//! Whether a field proxy can be made with a name of a type.
+template <typename Name>
+concept CanMakeFieldWithName =
+    requires { MakeField(std::declval<Name>(), &Packet::major_minor_verions); };
+
 }  // namespace
 
 TEST(CStyleFieldAccessProxy, Get) {
@@ -93,6 +122,8 @@ TEST(CStyleFieldAccessProxy, Get) {
 
     EXPECT_EQ(vt::opposite_endian_item_count.Get(pkg),
               std::byteswap(pkg.opposite_endian_item_count));
+    EXPECT_EQ(vt::static_endian_item_count.Get(pkg),
+              std::byteswap(pkg.opposite_endian_item_count));
     EXPECT_EQ(vt::type.Get(pkg), pkg.type);
     EXPECT_EQ(vt::version.Get(pkg), pkg.major_minor_verions);
     EXPECT_EQ(vt::first_item.Get(pkg), pkg.first_item);
@@ -105,10 +136,67 @@ TEST(CStyleFieldAccessProxy, Get) {
     std::ranges::copy(pkg_items.remain_items, std::back_inserter(items));
     EXPECT_EQ(vt::flexible_items.GetAt(pkg, 0), items.front());
     EXPECT_EQ(vt::flexible_items.GetAll(pkg), items);
+    EXPECT_TRUE(std::ranges::equal(vt::flexible_items.View(pkg), items));
 
     EXPECT_EQ(vt::fixed_flexible_items.Get(pkg), items);
 }
 
+TEST(CStyleFieldAccessProxy, StaticField) {
+    PacketItems pkg_items;
+    auto& pkg {static_cast<Packet&>(pkg_items)};
+
+    EXPECT_EQ(vt::static_version.GetName(), vt::version.GetName());
+    EXPECT_EQ(vt::static_version.Get(pkg), vt::version.Get(pkg));
+    EXPECT_EQ(vt::static_opposite_endian_item_count.Get(pkg),
+              vt::opposite_endian_item_count.Get(pkg));
+    EXPECT_EQ(vt::static_opposite_endian_item_count.Format(pkg),
+              vt::opposite_endian_item_count.Format(pkg));
+
+    vt::static_opposite_endian_item_count.Set(pkg, 1);
+    EXPECT_EQ(std::byteswap(pkg.opposite_endian_item_count), 1);
+
+    const auto major_version {
+        MakeBitField("The major version", vt::static_version, CHAR_BIT, CHAR_BIT)};
+    major_version.Set(pkg, 0xFF);
+    EXPECT_EQ(bit::GetHighByte(pkg.major_minor_verions), 0xFF);
+}
+
+TEST(CStyleFieldAccessProxy, StaticBitField) {
+    PacketItems pkg_items;
+    auto& pkg {static_cast<Packet&>(pkg_items)};
+
+    EXPECT_EQ(vt::static_major_version.Get(pkg), vt::major_version.Get(pkg));
+    EXPECT_EQ(vt::static_minor_version.Get(pkg), vt::minor_version.Get(pkg));
+    EXPECT_EQ(vt::static_is_version_first_bit_set.Get(pkg),
+              vt::is_version_first_bit_set.Get(pkg));
+
+    constexpr std::uint8_t new_major_version {0xFF};
+    constexpr std::uint8_t new_minor_version {0xAA};
+    pkg.major_minor_verions = 0;
+    vt::static_major_version.Set(pkg, new_major_version);
+    vt::static_minor_version.Set(pkg, new_minor_version);
+    EXPECT_EQ(pkg.major_minor_verions, bit::CombineBytes(new_major_version, new_minor_version));
+
+    vt::static_is_version_first_bit_set.Set(pkg, true);
+    EXPECT_TRUE(bit::IsBitSet(pkg.major_minor_verions, 0));
+    vt::static_is_version_first_bit_set.Set(pkg, false);
+    EXPECT_FALSE(bit::IsBitSet(pkg.major_minor_verions, 0));
+    EXPECT_EQ(vt::static_major_version.Get(pkg), new_major_version);
+}
+
+TEST(CStyleFieldAccessProxy, Name) {
+    // Names are not copied, so temporary strings that would dangle are rejected.
+    static_assert(CanMakeFieldWithName<const char*>);
+    static_assert(CanMakeFieldWithName<std::string_view>);
+    static_assert(CanMakeFieldWithName<const std::string&>);
+    static_assert(!CanMakeFieldWithName<std::string>);
+
+    const std::string name {std::format("The {}", "version")};
+    const auto version {MakeField(name, &Packet::major_minor_verions)};
+    EXPECT_EQ(version.GetName(), name);
+    EXPECT_EQ(version.GetName().data(), name.data());
+}
+
 TEST(CStyleFieldAccessProxy, Set) {
     PacketItems pkg_items;
     auto& pkg {static_cast<Packet&>(pkg_items)};
@@ -116,6 +204,10 @@ TEST(CStyleFieldAccessProxy, Set) {
         pkg.opposite_endian_item_count = 0;
         vt::opposite_endian_item_count.Set(pkg, Packet::max_items);
         EXPECT_EQ(std::byteswap(pkg.opposite_endian_item_count), Packet::max_items);
+
+        pkg.opposite_endian_item_count = 0;
+        vt::static_endian_item_count.Set(pkg, Packet::max_items);
+        EXPECT_EQ(std::byteswap(pkg.opposite_endian_item_count), Packet::max_items);
     }
     {
         constexpr String type {'t', 'e', 's', 't'};
@@ -143,6 +235,9 @@ TEST(CStyleFieldAccessProxy, Set) {
         vt::flexible_items.SetAt(pkg, 1, new_item);
         EXPECT_EQ(pkg_items.remain_items[0], new_item);
 
+        vt::flexible_items.View(pkg)[2] = new_item;
+        EXPECT_EQ(pkg_items.remain_items[1], new_item);
+
         vt::flexible_items.SetAll(pkg, new_items, false);
         EXPECT_NE(std::byteswap(pkg.opposite_endian_item_count), new_items.size());
 
@@ -153,6 +248,294 @@ TEST(CStyleFieldAccessProxy, Set) {
                                               pkg_items.remain_items[1]};
         EXPECT_EQ(read_items, new_items);
     }
+    {
+        constexpr Item new_item {'l', 'i', 's', 't'};
+        vt::flexible_items.SetAll(pkg, {new_item, new_item});
+        EXPECT_EQ(vt::flexible_items.GetAll(pkg), FlexibleArray<Item>(2, new_item));
+    }
+}
+
+TEST(CStyleFieldAccessProxy, BitFieldGroup) {
+    PacketItems pkg_items;
+    auto& pkg {static_cast<Packet&>(pkg_items)};
+    {
+        const auto versions {MakeBitFieldGroup(vt::major_version, vt::minor_version)};
+        EXPECT_EQ(versions.Get(pkg),
+                  std::make_tuple(vt::major_version.Get(pkg), vt::minor_version.Get(pkg)));
+
+        constexpr std::uint8_t new_major_version {0xFF};
+        constexpr std::uint8_t new_minor_version {0xAA};
+        versions.Set(pkg, new_major_version, new_minor_version);
+        EXPECT_EQ(pkg.major_minor_verions, bit::CombineBytes(new_major_version, new_minor_version));
+    }
+    {
+        const auto low_count {
+            MakeBitField<0, CHAR_BIT>("The low byte of the count", vt::opposite_endian_item_count)};
+        const auto high_count {MakeBitField<CHAR_BIT, CHAR_BIT>("The high byte of the count",
+                                                                vt::opposite_endian_item_count)};
+        const auto counts {MakeBitFieldGroup(low_count, high_count)};
+
+        counts.Set(pkg, std::make_tuple(0x34, 0x12));
+        EXPECT_EQ(vt::opposite_endian_item_count.Get(pkg), 0x1234);
+        EXPECT_EQ(counts.Get(pkg), std::make_tuple(0x34, 0x12));
+    }
+    {
+        constexpr auto static_minor_version {
+            MakeBitField<0, CHAR_BIT, std::uint8_t>("The minor version", vt::static_version)};
+        constexpr auto versions {MakeBitFieldGroup(vt::static_major_version, static_minor_version)};
+
+        versions.Set(pkg, 0x12, 0x34);
+        EXPECT_EQ(pkg.major_minor_verions, 0x1234);
+        EXPECT_EQ(versions.Get(pkg), std::make_tuple(0x12, 0x34));
+    }
+    {
+        // Parent fields with the same name but a different endianness are different fields.
+        const auto opposite_endian_version {
+            MakeField("The version", &Packet::major_minor_verions, GetOppositeEndian())};
+        EXPECT_TRUE(impl::IsSameField(vt::version, vt::version));
+        EXPECT_FALSE(impl::IsSameField(vt::version, opposite_endian_version));
+    }
+}
+
+TEST(CStyleFieldAccessProxy, ByteBuffer) {
+    static_assert(impl::GetMemberOffset(&Packet::opposite_endian_item_count)
+                  == offsetof(Packet, opposite_endian_item_count));
+    static_assert(impl::GetMemberOffset(&Packet::first_item) == offsetof(Packet, first_item));
+
+    // The offset of a pointer-to-member known only at runtime.
+    auto count_member {&Packet::opposite_endian_item_count};
+    EXPECT_EQ(impl::GetMemberOffset(count_member), offsetof(Packet, opposite_endian_item_count));
+
+    const PacketItems pkg_items;
+    const auto& pkg {static_cast<const Packet&>(pkg_items)};
+
+    // Place the object at an unaligned position.
+    std::vector<std::byte> buffer(sizeof(Packet) + 1);
+    const auto bytes {std::span {buffer}.subspan(1)};
+    std::memcpy(bytes.data(), &pkg, sizeof(Packet));
+    const std::span<const std::byte> const_bytes {bytes};
+
+    EXPECT_EQ(vt::version.Get(const_bytes), vt::version.Get(pkg));
+    EXPECT_EQ(vt::type.Get(const_bytes), vt::type.Get(pkg));
+    EXPECT_EQ(vt::opposite_endian_item_count.Get(const_bytes),
+              vt::opposite_endian_item_count.Get(pkg));
+    EXPECT_EQ(vt::static_opposite_endian_item_count.Get(const_bytes),
+              vt::static_opposite_endian_item_count.Get(pkg));
+    EXPECT_EQ(vt::major_version.Get(const_bytes), vt::major_version.Get(pkg));
+    EXPECT_EQ(vt::static_major_version.Get(const_bytes), vt::static_major_version.Get(pkg));
+    EXPECT_EQ(vt::is_version_first_bit_set.Get(const_bytes),
+              vt::is_version_first_bit_set.Get(pkg));
+
+    vt::opposite_endian_item_count.Set(bytes, 1);
+    vt::static_major_version.Set(bytes, 0xFF);
+    vt::minor_version.Set(bytes, 0xAA);
+
+    Packet modified;
+    std::memcpy(&modified, bytes.data(), sizeof(Packet));
+    EXPECT_EQ(vt::opposite_endian_item_count.Get(modified), 1);
+    EXPECT_EQ(modified.major_minor_verions, bit::CombineBytes(0xFF, 0xAA));
+    EXPECT_EQ(modified.type, pkg.type);
+}
+
+TEST(CStyleFieldAccessProxy, ValidateFlexibleArray) {
+    PacketItems pkg_items;
+    auto& pkg {static_cast<Packet&>(pkg_items)};
+    EXPECT_EQ(vt::flexible_items.GetByteSize(pkg), sizeof(PacketItems));
+
+    const auto items {vt::flexible_items.Validate(pkg, sizeof(PacketItems))};
+    ASSERT_TRUE(items.has_value());
+    EXPECT_TRUE(std::ranges::equal(*items, vt::flexible_items.View(pkg)));
+
+    EXPECT_FALSE(vt::flexible_items.Validate(pkg, sizeof(PacketItems) - 1).has_value());
+    EXPECT_FALSE(vt::flexible_items.Validate(pkg, sizeof(Packet) - 1).has_value());
+
+    vt::opposite_endian_item_count.Set(pkg, std::numeric_limits<std::size_t>::max());
+    EXPECT_FALSE(vt::flexible_items.Validate(pkg, sizeof(PacketItems)).has_value());
+
+    vt::opposite_endian_item_count.Set(pkg, 0);
+    EXPECT_EQ(vt::flexible_items.GetByteSize(pkg), sizeof(Packet));
+    EXPECT_TRUE(vt::flexible_items.Validate(pkg, sizeof(Packet)).value().empty());
+
+    const auto fixed_items {MakeFlexibleArrayField("Items", &Packet::first_item,
+                                                   vt::opposite_endian_item_count, 1)};
+    EXPECT_FALSE(fixed_items.Validate(pkg, sizeof(PacketItems)).has_value());
+}
+
+TEST(CStyleFieldAccessProxy, RecordStream) {
+    const std::vector<std::size_t> counts {2, 0, 3, 1};
+
+    std::vector<std::byte> buffer;
+    for (const auto count : counts) {
+        Packet pkg;
+        vt::opposite_endian_item_count.Set(pkg, count);
+        const auto begin {buffer.size()};
+        buffer.resize(begin + vt::flexible_items.GetByteSize(pkg));
+        std::memcpy(buffer.data() + begin, &pkg, sizeof(Packet));
+        for (std::size_t i {0}; i != count; ++i) {
+            const Item item {static_cast<char>('a' + count), static_cast<char>('a' + i)};
+            std::memcpy(buffer.data() + begin + offsetof(Packet, first_item) + i * sizeof(Item),
+                        &item, sizeof(Item));
+        }
+    }
+
+    // Append a truncated record.
+    buffer.resize(buffer.size() + sizeof(Packet) - 1);
+
+    const auto records {MakeRecordStream(buffer, vt::flexible_items)};
+    static_assert(std::ranges::forward_range<decltype(records)>);
+
+    std::size_t i {0};
+    auto it {records.begin()};
+    for (; it != records.end(); ++it, ++i) {
+        const auto& [obj, elems, bytes] {*it};
+        ASSERT_LT(i, counts.size());
+        EXPECT_EQ(vt::opposite_endian_item_count.Get(obj), counts[i]);
+        EXPECT_EQ(elems.size(), counts[i]);
+        EXPECT_EQ(bytes.size(), vt::flexible_items.GetByteSize(obj));
+        for (std::size_t j {0}; j != elems.size(); ++j) {
+            EXPECT_EQ(elems[j].msg[0], static_cast<char>('a' + counts[i]));
+            EXPECT_EQ(elems[j].msg[1], static_cast<char>('a' + j));
+        }
+    }
+
+    EXPECT_EQ(i, counts.size());
+    EXPECT_EQ(it.GetRemaining().size(), sizeof(Packet) - 1);
+    EXPECT_EQ(it.GetStop(), std::remove_cvref_t<decltype(records)>::Stop::Invalid);
+
+    // Iterators do not refer to the stream, so they remain valid after it is destroyed.
+    static_assert(std::ranges::borrowed_range<decltype(records)>);
+    const auto first {MakeRecordStream(buffer, vt::flexible_items).begin()};
+    EXPECT_EQ(vt::opposite_endian_item_count.Get((*first).obj), counts.front());
+    EXPECT_EQ(std::ranges::distance(first, std::default_sentinel), counts.size());
+}
+
+TEST(CStyleFieldAccessProxy, RecordStreamAlignment) {
+    // The structure is not packed, so its alignment is greater than one.
+    struct Record {
+        std::uint32_t count {0};
+        std::uint8_t first_data[1];
+    };
+
+    static_assert(alignof(Record) > 1);
+
+    constexpr auto count {MakeField("The number of data", &Record::count)};
+    constexpr auto data {MakeFlexibleArrayField("Data", &Record::first_data, count)};
+    using Stop = RecordStream<std::remove_const_t<decltype(data)>>::Stop;
+
+    alignas(Record) std::array<std::byte, 64> buffer {};
+    const auto write {[&buffer, &data](const std::vector<std::size_t>& counts) {
+        std::size_t size {0};
+        for (const auto count : counts) {
+            Record record;
+            record.count = static_cast<std::uint32_t>(count);
+            std::memcpy(buffer.data() + size, &record, sizeof(Record));
+            size += data.GetByteSize(count);
+        }
+
+        return std::span<const std::byte> {buffer}.first(size);
+    }};
+
+    {
+        // Each record occupies a multiple of the alignment, so all records are consumed.
+        auto it {MakeRecordStream(write({3, 4, 0}), data).begin()};
+        EXPECT_EQ(std::ranges::distance(it, std::default_sentinel), 3);
+        std::ranges::advance(it, std::default_sentinel);
+
+        EXPECT_TRUE(it.GetRemaining().empty());
+        EXPECT_EQ(it.GetStop(), Stop::End);
+    }
+    {
+        // A record with an odd number of elements misaligns the next one, so iteration stops early.
+        const auto bytes {write({3, 5, 2})};
+        auto it {MakeRecordStream(bytes, data).begin()};
+        EXPECT_EQ(std::ranges::distance(it, std::default_sentinel), 2);
+        std::ranges::advance(it, std::default_sentinel);
+
+        EXPECT_EQ(it.GetRemaining().size(),
+                  bytes.size() - data.GetByteSize(3) - data.GetByteSize(5));
+        EXPECT_EQ(it.GetStop(), Stop::Misaligned);
+    }
+}
+
+TEST(CStyleFieldAccessProxy, ExtractColumn) {
+    std::vector<Packet> pkgs(1000);
+    for (std::size_t i {0}; i != pkgs.size(); ++i) {
+        pkgs[i].major_minor_verions = static_cast<std::uint16_t>(i * 7);
+        vt::opposite_endian_item_count.Set(pkgs[i], i);
+    }
+
+    const auto expect_column {[&pkgs](const auto& field) {
+        using Value = typename std::decay_t<decltype(field)>::Value;
+        const auto column {std::make_unique<Value[]>(pkgs.size())};
+        ExtractColumn(field, pkgs, std::span {column.get(), pkgs.size()});
+        for (std::size_t i {0}; i != pkgs.size(); ++i) {
+            EXPECT_EQ(column[i], field.Get(pkgs[i]));
+        }
+    }};
+
+    expect_column(vt::version);
+    expect_column(vt::static_version);
+    expect_column(vt::opposite_endian_item_count);
+    expect_column(vt::static_endian_item_count);
+    expect_column(vt::major_version);
+    expect_column(vt::minor_version);
+    expect_column(vt::static_major_version);
+    expect_column(vt::is_version_first_bit_set);
+    expect_column(vt::static_is_version_first_bit_set);
+}
+
+TEST(CStyleFieldAccessProxy, ScatterColumn) {
+    constexpr std::size_t count {1000};
+
+    const auto expect_scatter {[](const auto& field) {
+        using Value = typename std::decay_t<decltype(field)>::Value;
+        std::vector<Packet> pkgs(count);
+        const auto vals {std::make_unique<Value[]>(count)};
+        for (std::size_t i {0}; i != count; ++i) {
+            vals[i] = static_cast<Value>(i % 3);
+        }
+
+        ScatterColumn(field, std::span<const Value> {vals.get(), count}, pkgs);
+        for (std::size_t i {0}; i != count; ++i) {
+            EXPECT_EQ(field.Get(pkgs[i]), vals[i]);
+        }
+
+        return pkgs;
+    }};
+
+    expect_scatter(vt::version);
+    expect_scatter(vt::static_version);
+    expect_scatter(vt::opposite_endian_item_count);
+    expect_scatter(vt::static_endian_item_count);
+    expect_scatter(vt::static_opposite_endian_item_count);
+    expect_scatter(vt::is_version_first_bit_set);
+    expect_scatter(vt::static_is_version_first_bit_set);
+    for (const auto& pkg : expect_scatter(vt::major_version)) {
+        EXPECT_EQ(vt::minor_version.Get(pkg), bit::GetLowByte(Packet {}.major_minor_verions));
+    }
+
+    for (const auto& pkg : expect_scatter(vt::static_minor_version)) {
+        EXPECT_EQ(vt::major_version.Get(pkg), bit::GetHighByte(Packet {}.major_minor_verions));
+    }
+}
+
+TEST(CStyleFieldAccessProxy, ExtractColumns) {
+    std::vector<Packet> pkgs(1000);
+    for (std::size_t i {0}; i != pkgs.size(); ++i) {
+        pkgs[i].major_minor_verions = static_cast<std::uint16_t>(i * 7);
+        vt::opposite_endian_item_count.Set(pkgs[i], i);
+    }
+
+    std::vector<std::uint16_t> versions(pkgs.size());
+    std::vector<std::size_t> item_counts(pkgs.size());
+    std::vector<std::uint16_t> major_versions(pkgs.size());
+    ExtractColumns(std::make_tuple(vt::version, vt::opposite_endian_item_count, vt::major_version),
+                   pkgs, versions, item_counts, major_versions);
+    for (std::size_t i {0}; i != pkgs.size(); ++i) {
+        EXPECT_EQ(versions[i], vt::version.Get(pkgs[i]));
+        EXPECT_EQ(item_counts[i], i);
+        EXPECT_EQ(major_versions[i], vt::major_version.Get(pkgs[i]));
+    }
 }
 
 TEST(CStyleFieldAccessProxy, Format) {
@@ -166,6 +549,24 @@ TEST(CStyleFieldAccessProxy, Format) {
                   fm::FormatVersion(pkg, vt::minor_version.Get(pkg)));
         EXPECT_EQ(vt::flexible_items.Format(pkg), fm::FormatItems(vt::flexible_items.Get(pkg)));
     }
+    {
+        std::string formatted;
+        vt::opposite_endian_item_count.FormatTo(std::back_inserter(formatted), pkg);
+        vt::minor_version.FormatTo(std::back_inserter(formatted), pkg);
+        EXPECT_EQ(formatted, vt::opposite_endian_item_count.Format(pkg)
+                                 + vt::minor_version.Format(pkg));
+    }
+    {
+        const auto version {MakeField("The version", &Packet::major_minor_verions,
+                                      [](auto out, const Packet&, const std::uint16_t version) {
+                                          return std::format_to(out, "v{}", version);
+                                      })};
+
+        std::string formatted;
+        version.FormatTo(std::back_inserter(formatted), pkg);
+        EXPECT_EQ(formatted, std::format("v{}", pkg.major_minor_verions));
+        EXPECT_EQ(version.Format(pkg), formatted);
+    }
     {
         std::stringstream target, formatted;
         target << std::format("{}: {}\n", vt::opposite_endian_item_count.GetName(),
@@ -179,4 +580,120 @@ TEST(CStyleFieldAccessProxy, Format) {
 
         EXPECT_EQ(formatted.str(), target.str());
     }
-}
\ No newline at end of file
+    {
+        const auto fields {
+            std::make_tuple(vt::opposite_endian_item_count, vt::minor_version, vt::flexible_items)};
+        std::stringstream target;
+        PrintFields(target, pkg, fields);
+
+        std::string buffer;
+        FormatFields(buffer, pkg, fields);
+        EXPECT_EQ(buffer, target.str());
+
+        std::stringstream printed;
+        PrintFields(printed, pkg, fields, buffer);
+        PrintFields(printed, pkg, fields, buffer);
+        EXPECT_EQ(printed.str(), target.str() + target.str());
+
+        std::array<char, 8> truncated {};
+        const auto [end, size] {FormatFields(truncated, pkg, fields)};
+        EXPECT_EQ(size, target.str().size());
+        EXPECT_EQ(end, truncated.data() + truncated.size());
+        EXPECT_EQ(std::string(truncated.data(), end), target.str().substr(0, truncated.size()));
+    }
+}
+
+TEST(CStyleFieldAccessProxy, DiffFields) {
+    const PacketItems old_pkg_items;
+    const auto& old_pkg {static_cast<const Packet&>(old_pkg_items)};
+    PacketItems new_pkg_items;
+    auto& new_pkg {static_cast<Packet&>(new_pkg_items)};
+
+    const auto fields {std::make_tuple(vt::opposite_endian_item_count, vt::major_version,
+                                       vt::minor_version, vt::type)};
+    const auto fields_with_items {std::tuple_cat(fields, std::make_tuple(vt::flexible_items))};
+    {
+        std::string diff;
+        EXPECT_TRUE(DiffFields(diff, old_pkg, new_pkg, fields).empty());
+        EXPECT_TRUE(DiffFields(diff, old_pkg, new_pkg, fields_with_items).empty());
+    }
+    {
+        vt::major_version.Set(new_pkg, 0xFF);
+        const auto target {std::format("- {}\n+ {}\n", vt::major_version.Format(old_pkg),
+                                       vt::major_version.Format(new_pkg))};
+
+        std::string diff;
+        EXPECT_EQ(DiffFields(diff, old_pkg, new_pkg, fields), target);
+    }
+    {
+        // Elements after the structure are compared as well.
+        new_pkg_items.remain_items[0] = Item {'d', 'i', 'f', 'f'};
+        std::string diff;
+        DiffFields(diff, old_pkg, new_pkg, fields_with_items);
+        EXPECT_TRUE(diff.ends_with(std::format("- {}\n+ {}\n", vt::flexible_items.Format(old_pkg),
+                                               vt::flexible_items.Format(new_pkg))));
+    }
+}
+
+TEST(CStyleFieldAccessProxy, HashFields) {
+    const PacketItems pkg_items;
+    const auto& pkg {static_cast<const Packet&>(pkg_items)};
+    PacketItems other_pkg_items;
+    auto& other_pkg {static_cast<Packet&>(other_pkg_items)};
+
+    const auto fields {std::make_tuple(vt::version, vt::type, vt::major_version)};
+    EXPECT_EQ(HashFields(pkg, fields), HashFields(other_pkg, fields));
+
+    // Fields that are not selected do not affect the hash.
+    vt::opposite_endian_item_count.Set(other_pkg, 1);
+    EXPECT_EQ(HashFields(pkg, fields), HashFields(other_pkg, fields));
+
+    vt::type.Set(other_pkg, {'e', 'p', 'y', 't'});
+    EXPECT_NE(HashFields(pkg, fields), HashFields(other_pkg, fields));
+    vt::type.Set(other_pkg, vt::type.Get(pkg));
+
+    vt::minor_version.Set(other_pkg, 0xAA);
+    EXPECT_NE(HashFields(pkg, fields), HashFields(other_pkg, fields));
+    EXPECT_NE(HashFields(pkg, std::make_tuple(vt::version)),
+              HashFields(pkg, std::make_tuple(vt::type)));
+    {
+        const auto items {std::make_tuple(vt::fixed_flexible_items)};
+        PacketItems items_pkg_items;
+        auto& items_pkg {static_cast<Packet&>(items_pkg_items)};
+        EXPECT_EQ(HashFields(pkg, items), HashFields(items_pkg, items));
+
+        items_pkg_items.remain_items[0] = Item {'h', 'a', 's', 'h'};
+        EXPECT_NE(HashFields(pkg, items), HashFields(items_pkg, items));
+    }
+    {
+        std::array<Packet, 3> pkgs;
+        vt::version.Set(pkgs[1], 1);
+        vt::type.Set(pkgs[2], {'e', 'p', 'y', 't'});
+
+        std::array<std::uint64_t, pkgs.size()> hashes;
+        HashFields(std::span<const Packet> {pkgs}, fields, std::span {hashes});
+        for (std::size_t i {0}; i != pkgs.size(); ++i) {
+            EXPECT_EQ(hashes[i], HashFields(pkgs[i], fields));
+        }
+
+        EXPECT_EQ(hashes[0], HashFields(pkg, fields));
+        EXPECT_NE(hashes[1], hashes[0]);
+        EXPECT_NE(hashes[2], hashes[0]);
+    }
+    {
+        // Runs of adjacent members are interleaved with other fields, across more than one chunk.
+        std::vector<Packet> pkgs(300);
+        for (std::size_t i {0}; i != pkgs.size(); ++i) {
+            vt::version.Set(pkgs[i], static_cast<std::uint16_t>(i));
+            vt::opposite_endian_item_count.Set(pkgs[i], i % 7);
+        }
+
+        const auto mixed_fields {std::make_tuple(vt::version, vt::type, vt::minor_version,
+                                                 vt::opposite_endian_item_count, vt::version)};
+        std::vector<std::uint64_t> hashes(pkgs.size());
+        HashFields(std::span<const Packet> {pkgs}, mixed_fields, std::span {hashes});
+        for (std::size_t i {0}; i != pkgs.size(); ++i) {
+            EXPECT_EQ(hashes[i], HashFields(pkgs[i], mixed_fields));
+        }
+    }
+}
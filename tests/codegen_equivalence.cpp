@@ -0,0 +1,200 @@
+/**
+ * @file codegen_equivalence.cpp
+ * @brief Pairs of functions that access fields with proxies and by hand.
+ *
+ * @details
+ * Each function @p proxy_<name> must compile to the same instructions as @p raw_<name>.
+ * They are compared by @p compare_codegen.cmake after the object file is built.
+ */
+
+#include "endian.h"
+#include "field_access_proxy/field_access_proxy.h"
+
+#include <bit>
+#include <climits>
+#include <cstdint>
+
+using namespace field_access_proxy;
+
+namespace {
+
+#pragma pack(push, 1)
+
+struct Packet {
+    std::uint16_t major_minor_version;
+    std::uint32_t item_count;
+    std::uint32_t opposite_endian_item_count;
+    std::uint32_t first_item[1];
+};
+
+#pragma pack(pop)
+
+namespace vt {
+
+constexpr auto version {MakeField("The version", &Packet::major_minor_version)};
+constexpr auto item_count {MakeField("The number of items", &Packet::item_count)};
+constexpr auto opposite_endian_item_count {
+    MakeField("The number of items", &Packet::opposite_endian_item_count, GetOppositeEndian())};
+constexpr auto static_endian_item_count {
+    MakeField<GetOppositeEndian()>("The number of items", &Packet::opposite_endian_item_count)};
+
+constexpr auto major_version {MakeBitField("The major version", version, CHAR_BIT, CHAR_BIT)};
+constexpr auto static_major_version {
+    MakeBitField<CHAR_BIT, CHAR_BIT, std::uint16_t>("The major version", version)};
+constexpr auto is_version_first_bit_set {
+    MakeBoolField("Whether the first bit of the version is set", version, 0)};
+constexpr auto static_is_version_first_bit_set {
+    MakeBoolField<0>("Whether the first bit of the version is set", version)};
+
+}  // namespace vt
+
+class Message {
+public:
+    DEFINE_UNDERLYING_FIELD_WITH_PROXY(Message, private, std::uint16_t, major_minor_version, {0})
+    DEFINE_BIT_FIELD_WITH_PROXY(Message, major_minor_version, public, std::uint16_t, MajorVersion,
+                                CHAR_BIT, CHAR_BIT)
+    DEFINE_BOOL_FIELD_WITH_PROXY(Message, major_minor_version, public, IsFirstVersionBitSet,
+                                 SetFirstVersionBit, first_version_bit, 0)
+    DEFINE_INTEGRAL_FIELD_WITH_ENDIAN_PROXY(Message, std::uint32_t, public, ItemCount, private,
+                                            item_count, GetOppositeEndian(), {0})
+};
+
+//! A structure with the same layout as @p Message, accessed by hand.
+struct RawMessage {
+    std::uint16_t major_minor_version;
+    std::uint32_t item_count;
+};
+
+constexpr std::uint16_t major_version_mask {0xFF00};
+
+}  // namespace
+
+extern "C" {
+
+// Regular fields.
+std::uint32_t raw_field_get(const Packet& pkg) noexcept {
+    return pkg.item_count;
+}
+
+std::uint32_t proxy_field_get(const Packet& pkg) noexcept {
+    return vt::item_count.Get(pkg);
+}
+
+void raw_field_set(Packet& pkg, const std::uint32_t val) noexcept {
+    pkg.item_count = val;
+}
+
+void proxy_field_set(Packet& pkg, const std::uint32_t val) noexcept {
+    vt::item_count.Set(pkg, val);
+}
+
+std::uint32_t raw_opposite_endian_field_get(const Packet& pkg) noexcept {
+    return std::byteswap(pkg.opposite_endian_item_count);
+}
+
+std::uint32_t proxy_opposite_endian_field_get(const Packet& pkg) noexcept {
+    return vt::opposite_endian_item_count.Get(pkg);
+}
+
+std::uint32_t raw_static_endian_field_get(const Packet& pkg) noexcept {
+    return std::byteswap(pkg.opposite_endian_item_count);
+}
+
+std::uint32_t proxy_static_endian_field_get(const Packet& pkg) noexcept {
+    return vt::static_endian_item_count.Get(pkg);
+}
+
+void raw_static_endian_field_set(Packet& pkg, const std::uint32_t val) noexcept {
+    pkg.opposite_endian_item_count = std::byteswap(val);
+}
+
+void proxy_static_endian_field_set(Packet& pkg, const std::uint32_t val) noexcept {
+    vt::static_endian_item_count.Set(pkg, val);
+}
+
+// Bit fields.
+void raw_bit_field_set(Packet& pkg, const std::uint16_t val) noexcept {
+    pkg.major_minor_version = static_cast<std::uint16_t>(
+        (pkg.major_minor_version & ~major_version_mask) | ((val << CHAR_BIT) & major_version_mask));
+}
+
+void proxy_bit_field_set(Packet& pkg, const std::uint16_t val) noexcept {
+    vt::major_version.Set(pkg, val);
+}
+
+std::uint16_t raw_static_bit_field_get(const Packet& pkg) noexcept {
+    return static_cast<std::uint16_t>(pkg.major_minor_version >> CHAR_BIT);
+}
+
+std::uint16_t proxy_static_bit_field_get(const Packet& pkg) noexcept {
+    return vt::static_major_version.Get(pkg);
+}
+
+void raw_static_bit_field_set(Packet& pkg, const std::uint16_t val) noexcept {
+    pkg.major_minor_version = static_cast<std::uint16_t>(
+        (pkg.major_minor_version & ~major_version_mask) | ((val << CHAR_BIT) & major_version_mask));
+}
+
+void proxy_static_bit_field_set(Packet& pkg, const std::uint16_t val) noexcept {
+    vt::static_major_version.Set(pkg, val);
+}
+
+// Boolean fields.
+bool raw_bool_field_get(const Packet& pkg) noexcept {
+    return (pkg.major_minor_version & 1) != 0;
+}
+
+bool proxy_bool_field_get(const Packet& pkg) noexcept {
+    return vt::is_version_first_bit_set.Get(pkg);
+}
+
+bool raw_static_bool_field_get(const Packet& pkg) noexcept {
+    return (pkg.major_minor_version & 1) != 0;
+}
+
+bool proxy_static_bool_field_get(const Packet& pkg) noexcept {
+    return vt::static_is_version_first_bit_set.Get(pkg);
+}
+
+// Macro-defined getters and setters.
+std::uint16_t raw_macro_bit_field_get(const RawMessage& msg) noexcept {
+    return static_cast<std::uint16_t>(msg.major_minor_version >> CHAR_BIT);
+}
+
+std::uint16_t proxy_macro_bit_field_get(const Message& msg) noexcept {
+    return msg.GetMajorVersion();
+}
+
+void raw_macro_bit_field_set(RawMessage& msg, const std::uint16_t val) noexcept {
+    msg.major_minor_version = static_cast<std::uint16_t>(
+        (msg.major_minor_version & ~major_version_mask) | ((val << CHAR_BIT) & major_version_mask));
+}
+
+void proxy_macro_bit_field_set(Message& msg, const std::uint16_t val) noexcept {
+    msg.SetMajorVersion(val);
+}
+
+bool raw_macro_bool_field_get(const RawMessage& msg) noexcept {
+    return (msg.major_minor_version & 1) != 0;
+}
+
+bool proxy_macro_bool_field_get(const Message& msg) noexcept {
+    return msg.IsFirstVersionBitSet();
+}
+
+std::uint32_t raw_macro_field_get(const RawMessage& msg) noexcept {
+    return std::byteswap(msg.item_count);
+}
+
+std::uint32_t proxy_macro_field_get(const Message& msg) noexcept {
+    return msg.GetItemCount();
+}
+
+void raw_macro_field_set(RawMessage& msg, const std::uint32_t val) noexcept {
+    msg.item_count = std::byteswap(val);
+}
+
+void proxy_macro_field_set(Message& msg, const std::uint32_t val) noexcept {
+    msg.SetItemCount(val);
+}
+}
@@ -0,0 +1,73 @@
+# Compare the disassembly of paired functions in an object file.
+#
+# Each function "proxy_<name>" must consist of the same instructions as "raw_<name>".
+# Addresses, comments and padding are ignored.
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DOBJECT=<object file> -P compare_codegen.cmake
+
+if(NOT OBJDUMP OR NOT OBJECT)
+    message(FATAL_ERROR "Both OBJDUMP and OBJECT must be specified.")
+endif()
+
+execute_process(
+    COMMAND ${OBJDUMP} -d --no-show-raw-insn ${OBJECT}
+    OUTPUT_VARIABLE disassembly
+    RESULT_VARIABLE result
+)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to disassemble ${OBJECT}.")
+endif()
+
+string(REPLACE ";" "\;" disassembly "${disassembly}")
+string(REPLACE "\n" ";" lines "${disassembly}")
+
+set(funcs "")
+set(func "")
+foreach(line IN LISTS lines)
+    if(line MATCHES "^[0-9a-f]+ <([A-Za-z0-9_]+)>:$")
+        set(func ${CMAKE_MATCH_1})
+        list(APPEND funcs ${func})
+        set(code_${func} "")
+    elseif(func AND line MATCHES "^ *[0-9a-f]+:\t(.*)$")
+        set(insn "${CMAKE_MATCH_1}")
+        if(insn MATCHES "nop|^xchg +%ax,%ax$")
+            continue()
+        endif()
+
+        # Jump targets are replaced by their offsets within the function.
+        string(REGEX REPLACE " *#.*$" "" insn "${insn}")
+        string(REGEX REPLACE "[0-9a-f]+ <[A-Za-z0-9_.]+(\\+0x[0-9a-f]+|)>" "<\\1>" insn "${insn}")
+        string(REGEX REPLACE "[ \t]+" " " insn "${insn}")
+        string(APPEND code_${func} "    ${insn}\n")
+    else()
+        set(func "")
+    endif()
+endforeach()
+
+set(pair_count 0)
+set(mismatches "")
+foreach(func IN LISTS funcs)
+    if(func MATCHES "^proxy_(.+)$")
+        set(raw_func raw_${CMAKE_MATCH_1})
+        if(NOT DEFINED code_${raw_func})
+            message(FATAL_ERROR "${func} has no counterpart ${raw_func}.")
+        endif()
+
+        math(EXPR pair_count "${pair_count} + 1")
+        if(NOT code_${func} STREQUAL code_${raw_func})
+            string(APPEND mismatches
+                "${func} differs from ${raw_func}.\n"
+                "${raw_func}:\n${code_${raw_func}}"
+                "${func}:\n${code_${func}}\n")
+        endif()
+    endif()
+endforeach()
+
+if(pair_count EQUAL 0)
+    message(FATAL_ERROR "No function pairs are found in ${OBJECT}.")
+elseif(mismatches)
+    message(FATAL_ERROR "${mismatches}")
+endif()
+
+message(STATUS "${pair_count} function pairs consist of the same instructions.")
@@ -0,0 +1,105 @@
+#include "field_access_proxy/field_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+using namespace field_access_proxy;
+
+namespace {
+
+using String = std::array<char, 4>;
+
+#pragma pack(push, 1)
+
+struct Record {
+    String type {'t', 'y', 'p', 'e'};
+    std::uint16_t major_minor_version {0};
+    std::uint32_t id {0};
+};
+
+#pragma pack(pop)
+
+namespace vt {
+
+constexpr auto type {MakeField("The type", &Record::type)};
+constexpr auto version {MakeField("The version", &Record::major_minor_version)};
+constexpr auto major_version {MakeBitField("The major version", version, CHAR_BIT, CHAR_BIT)};
+constexpr auto id {MakeField("The ID", &Record::id)};
+
+}  // namespace vt
+
+std::vector<Record> MakeRecords(const std::size_t count) {
+    std::vector<Record> records(count);
+    for (std::size_t i {0}; i != count; ++i) {
+        vt::id.Set(records[i], static_cast<std::uint32_t>(i));
+        vt::major_version.Set(records[i], static_cast<std::uint16_t>(i % 5));
+        vt::type.Set(records[i], {'t', static_cast<char>('a' + i % 3), 'p', 'e'});
+    }
+
+    return records;
+}
+
+}  // namespace
+
+TEST(FieldIndex, UniqueValues) {
+    const auto records {MakeRecords(1000)};
+    const auto index {MakeFieldIndex(vt::id, std::span<const Record> {records})};
+    EXPECT_EQ(index.GetSize(), records.size());
+    EXPECT_EQ(index.GetKeyCount(), records.size());
+
+    for (std::size_t i {0}; i != records.size(); ++i) {
+        EXPECT_EQ(index.Find(static_cast<std::uint32_t>(i)), i);
+        EXPECT_EQ(index.Count(static_cast<std::uint32_t>(i)), 1);
+    }
+
+    EXPECT_FALSE(index.Find(static_cast<std::uint32_t>(records.size())).has_value());
+    EXPECT_EQ(index.Count(static_cast<std::uint32_t>(records.size())), 0);
+}
+
+TEST(FieldIndex, DuplicateValues) {
+    const auto records {MakeRecords(100)};
+    const auto index {MakeFieldIndex(vt::major_version, std::span<const Record> {records})};
+    EXPECT_EQ(index.GetKeyCount(), 5);
+
+    for (std::uint16_t major_version {0}; major_version != 5; ++major_version) {
+        std::vector<std::size_t> positions;
+        index.ForEach(major_version, [&positions](const std::size_t pos) {
+            positions.push_back(pos);
+        });
+
+        EXPECT_EQ(positions.size(), records.size() / 5);
+        EXPECT_EQ(index.Count(major_version), positions.size());
+        EXPECT_TRUE(std::ranges::is_sorted(positions, std::ranges::greater {}));
+        EXPECT_TRUE(std::ranges::all_of(positions, [&records, major_version](const auto pos) {
+            return vt::major_version.Get(records[pos]) == major_version;
+        }));
+    }
+}
+
+TEST(FieldIndex, Insert) {
+    const auto records {MakeRecords(10)};
+    FieldIndex index {vt::type};
+    EXPECT_FALSE(index.Find({'t', 'a', 'p', 'e'}).has_value());
+
+    for (std::size_t i {0}; i != records.size(); ++i) {
+        index.Insert(records[i], i);
+        EXPECT_EQ(index.Find(vt::type.Get(records[i])), i);
+    }
+
+    EXPECT_EQ(index.GetKeyCount(), 3);
+    EXPECT_EQ(index.Count({'t', 'a', 'p', 'e'}), 4);
+    EXPECT_EQ(index.Count({'t', 'b', 'p', 'e'}), 3);
+    EXPECT_EQ(index.Count({'t', 'c', 'p', 'e'}), 3);
+
+    index.Clear();
+    EXPECT_EQ(index.GetSize(), 0);
+    EXPECT_FALSE(index.Find({'t', 'a', 'p', 'e'}).has_value());
+}
@@ -0,0 +1,174 @@
+#include "endian.h"
+#include "field_access_proxy/filter.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using namespace field_access_proxy;
+
+namespace {
+
+using String = std::array<char, 4>;
+
+#pragma pack(push, 1)
+
+struct Record {
+    String type {'t', 'y', 'p', 'e'};
+    std::uint16_t major_minor_version {0};
+    std::uint32_t opposite_endian_flags {0};
+};
+
+#pragma pack(pop)
+
+namespace vt {
+
+constexpr auto type {MakeField("The type", &Record::type)};
+constexpr auto version {MakeField("The version", &Record::major_minor_version)};
+constexpr auto major_version {MakeBitField("The major version", version, CHAR_BIT, CHAR_BIT)};
+constexpr auto minor_version {MakeBitField("The minor version", version, 0, CHAR_BIT)};
+constexpr auto flags {
+    MakeField("The flags", &Record::opposite_endian_flags, GetOppositeEndian())};
+constexpr auto is_valid {MakeBoolField("Whether the record is valid", flags, 0)};
+constexpr auto is_signed {MakeBoolField("Whether the record is signed", flags, 20)};
+
+}  // namespace vt
+
+std::vector<Record> MakeRecords(const std::size_t count) {
+    std::vector<Record> records(count);
+    for (std::size_t i {0}; i != count; ++i) {
+        vt::major_version.Set(records[i], static_cast<std::uint16_t>(i % 4));
+        vt::minor_version.Set(records[i], static_cast<std::uint16_t>(i % 3));
+        vt::is_valid.Set(records[i], i % 2 == 0);
+        vt::is_signed.Set(records[i], i % 5 == 0);
+        vt::type.Set(records[i], {'t', static_cast<char>('a' + i % 3), 'p', 'e'});
+    }
+
+    return records;
+}
+
+//! Evaluate a predicate and compare the selection with a reference function applied to each record.
+template <typename Predicate, typename Expected>
+void ExpectSelection(const Predicate& pred, const std::span<const Record> records,
+                     Expected expected) {
+    std::vector<std::uint64_t> selection(GetSelectionSize(records.size()), ~std::uint64_t {0});
+    Filter(pred, records, std::span {selection});
+    for (std::size_t i {0}; i != selection.size() * 64; ++i) {
+        const auto selected {(selection[i / 64] >> (i % 64) & 1) != 0};
+        EXPECT_EQ(selected, i < records.size() && expected(records[i])) << "Record " << i;
+    }
+}
+
+}  // namespace
+
+TEST(Filter, Eq) {
+    const auto records {MakeRecords(130)};
+    ExpectSelection(Eq(vt::major_version, 3), records, [](const Record& record) {
+        return vt::major_version.Get(record) == 3;
+    });
+
+    ExpectSelection(Eq(vt::version, 0x0102), records, [](const Record& record) {
+        return vt::version.Get(record) == 0x0102;
+    });
+
+    ExpectSelection(Eq(vt::type, String {'t', 'b', 'p', 'e'}), records, [](const Record& record) {
+        return vt::type.Get(record) == String {'t', 'b', 'p', 'e'};
+    });
+}
+
+TEST(Filter, IsSet) {
+    const auto records {MakeRecords(130)};
+    ExpectSelection(IsSet(vt::is_valid), records, [](const Record& record) {
+        return vt::is_valid.Get(record);
+    });
+
+    ExpectSelection(Eq(vt::is_signed, false), records, [](const Record& record) {
+        return !vt::is_signed.Get(record);
+    });
+}
+
+TEST(Filter, Combinators) {
+    const auto records {MakeRecords(200)};
+    ExpectSelection(Eq(vt::major_version, 3) && IsSet(vt::is_valid), records,
+                    [](const Record& record) {
+                        return vt::major_version.Get(record) == 3 && vt::is_valid.Get(record);
+                    });
+
+    ExpectSelection(Eq(vt::major_version, 1) || IsSet(vt::is_signed), records,
+                    [](const Record& record) {
+                        return vt::major_version.Get(record) == 1 || vt::is_signed.Get(record);
+                    });
+
+    ExpectSelection(!IsSet(vt::is_valid) && !Eq(vt::type, String {'t', 'a', 'p', 'e'}), records,
+                    [](const Record& record) {
+                        return !vt::is_valid.Get(record)
+                               && vt::type.Get(record) != String {'t', 'a', 'p', 'e'};
+                    });
+}
+
+TEST(Filter, FusedMasks) {
+    const auto records {MakeRecords(200)};
+
+    const auto versions {Eq(vt::major_version, 2) && Eq(vt::minor_version, 1)};
+    EXPECT_TRUE(versions.AsMask().has_value());
+    ExpectSelection(versions, records, [](const Record& record) {
+        return vt::major_version.Get(record) == 2 && vt::minor_version.Get(record) == 1;
+    });
+
+    const auto flags {IsSet(vt::is_valid) && IsSet(vt::is_signed) && IsSet(vt::is_valid)};
+    EXPECT_TRUE(flags.AsMask().has_value());
+    ExpectSelection(flags, records, [](const Record& record) {
+        return vt::is_valid.Get(record) && vt::is_signed.Get(record);
+    });
+
+    // Conflicting conditions on the same bits are not fused and select nothing.
+    const auto conflict {IsSet(vt::is_valid) && Eq(vt::is_valid, false)};
+    EXPECT_FALSE(conflict.AsMask().has_value());
+    ExpectSelection(conflict, records, [](const Record&) { return false; });
+}
+
+TEST(Filter, ValueOutOfRange) {
+    const auto records {MakeRecords(10)};
+    constexpr auto narrow_version {MakeBitField("The narrow version", vt::version, 0, 2)};
+    ExpectSelection(Eq(narrow_version, 4), records, [](const Record&) { return false; });
+
+    // A condition that can never match is not fused with conditions on the same parent field.
+    constexpr auto is_version_first_bit_set {
+        MakeBoolField("Whether the first bit of the version is set", vt::version, 0)};
+    const auto pred {Eq(narrow_version, 4) && IsSet(is_version_first_bit_set)};
+    EXPECT_FALSE(pred.AsMask().has_value());
+    ExpectSelection(pred, records, [](const Record&) { return false; });
+}
+
+TEST(Filter, EnumBitField) {
+    enum class Kind : std::uint8_t { A, B, C, D };
+
+    const auto records {MakeRecords(130)};
+    constexpr auto kind {MakeBitField<CHAR_BIT, 2, Kind>("The kind", vt::version)};
+    constexpr auto byte {
+        MakeBitField<0, CHAR_BIT, std::byte>("The minor version byte", vt::version)};
+    ExpectSelection(Eq(kind, Kind::C), records,
+                    [](const Record& record) { return vt::major_version.Get(record) == 2; });
+    ExpectSelection(Eq(byte, std::byte {1}), records,
+                    [](const Record& record) { return vt::minor_version.Get(record) == 1; });
+
+    const auto pred {Eq(kind, Kind::D) && Eq(byte, std::byte {2})};
+    EXPECT_TRUE(pred.AsMask().has_value());
+    ExpectSelection(pred, records, [](const Record& record) {
+        return vt::major_version.Get(record) == 3 && vt::minor_version.Get(record) == 2;
+    });
+}
+
+TEST(Filter, Empty) {
+    std::array<std::uint64_t, 1> selection {0};
+    Filter(IsSet(vt::is_valid), std::span<const Record> {}, std::span {selection});
+    EXPECT_EQ(selection[0], 0);
+    EXPECT_EQ(GetSelectionSize(0), 0);
+    EXPECT_EQ(GetSelectionSize(64), 1);
+    EXPECT_EQ(GetSelectionSize(65), 2);
+}
@@ -70,4 +70,5 @@ TEST(MacroDefinedFieldAccessProxy, Get) {
 
     const FlexibleArray<Item> items(pkg.GetItemCount(), Item {});
     EXPECT_EQ(pkg.GetItems(), items);
+    EXPECT_TRUE(std::ranges::equal(pkg.ViewItems(), items));
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "field_access_proxy/mapped_file.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace field_access_proxy;
+
+namespace {
+
+#pragma pack(push, 1)
+
+struct Record {
+    std::uint32_t id;
+    std::uint16_t count;
+    std::uint8_t first_data[1];
+};
+
+#pragma pack(pop)
+
+namespace vt {
+
+constexpr auto id {MakeField("The ID", &Record::id)};
+constexpr auto count {MakeField("The number of data", &Record::count)};
+constexpr auto data {MakeFlexibleArrayField("Data", &Record::first_data, count)};
+
+}  // namespace vt
+
+class MappedFileTest : public testing::Test {
+protected:
+    void TearDown() override {
+        std::filesystem::remove(path_);
+    }
+
+    const std::filesystem::path& Write(const std::vector<std::byte>& bytes) {
+        std::ofstream file {path_, std::ios::binary};
+        file.write(reinterpret_cast<const char*>(bytes.data()),
+                   static_cast<std::streamsize>(bytes.size()));
+        return path_;
+    }
+
+    std::filesystem::path path_ {std::filesystem::temp_directory_path()
+                                 / ("field_access_proxy_" + std::to_string(::getpid()))};
+};
+
+}  // namespace
+
+TEST_F(MappedFileTest, FixedSizeRecords) {
+    std::vector<std::byte> bytes;
+    for (std::uint32_t i {0}; i != 100; ++i) {
+        Record record {i, 1, {0}};
+        const auto begin {bytes.size()};
+        bytes.resize(begin + sizeof(Record));
+        std::memcpy(bytes.data() + begin, &record, sizeof(Record));
+    }
+
+    const auto file {MappedFile::Open(Write(bytes))};
+    ASSERT_TRUE(file.has_value());
+    EXPECT_EQ(file->GetBytes().size(), bytes.size());
+
+    const auto records {file->GetRecords<Record>()};
+    ASSERT_EQ(records.size(), 100);
+
+    std::vector<std::uint32_t> ids(records.size());
+    ExtractColumn(vt::id, records, ids);
+    for (std::uint32_t i {0}; i != ids.size(); ++i) {
+        EXPECT_EQ(ids[i], i);
+    }
+}
+
+TEST_F(MappedFileTest, VariableSizeRecords) {
+    const std::vector<std::uint16_t> counts {3, 1, 4};
+
+    std::vector<std::byte> bytes;
+    for (std::uint32_t i {0}; i != counts.size(); ++i) {
+        Record record {i, counts[i], {0}};
+        const auto begin {bytes.size()};
+        bytes.resize(begin + vt::data.GetByteSize(record));
+        std::memcpy(bytes.data() + begin, &record, sizeof(Record));
+    }
+
+    const auto file {MappedFile::Open(Write(bytes), MappedFile::Access::Random)};
+    ASSERT_TRUE(file.has_value());
+
+    std::uint32_t i {0};
+    for (const auto& [record, data, _] : file->GetRecordStream(vt::data)) {
+        EXPECT_EQ(vt::id.Get(record), i);
+        EXPECT_EQ(data.size(), counts[i]);
+        ++i;
+    }
+
+    EXPECT_EQ(i, counts.size());
+}
+
+TEST_F(MappedFileTest, EmptyFile) {
+    const auto file {MappedFile::Open(Write({}))};
+    ASSERT_TRUE(file.has_value());
+    EXPECT_TRUE(file->GetBytes().empty());
+    EXPECT_TRUE(file->GetRecords<Record>().empty());
+}
+
+TEST_F(MappedFileTest, NonexistentFile) {
+    const auto file {MappedFile::Open(path_)};
+    ASSERT_FALSE(file.has_value());
+    EXPECT_EQ(file.error(), std::errc::no_such_file_or_directory);
+}
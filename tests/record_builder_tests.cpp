@@ -0,0 +1,93 @@
+#include "field_access_proxy/record_builder.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace field_access_proxy;
+
+namespace {
+
+#pragma pack(push, 1)
+
+struct Record {
+    std::uint32_t id {0};
+    std::uint16_t count {0};
+    std::uint32_t first_data[1];
+};
+
+#pragma pack(pop)
+
+namespace vt {
+
+constexpr auto count {MakeField("The number of data", &Record::count)};
+constexpr auto data {MakeFlexibleArrayField("Data", &Record::first_data, count)};
+constexpr auto data_with_header {MakeFlexibleArrayField("Data", &Record::first_data, count, 2)};
+
+}  // namespace vt
+
+}  // namespace
+
+TEST(RecordBuilder, Build) {
+    const std::vector<std::uint32_t> data {1, 2, 3, 4, 5};
+    const auto builder {MakeRecordBuilder(vt::data)};
+    const auto record {builder.Build(data)};
+    ASSERT_TRUE(record);
+
+    EXPECT_EQ(record.GetByteSize(), offsetof(Record, first_data) + data.size() * sizeof(data[0]));
+    EXPECT_EQ(record->id, 0);
+    EXPECT_EQ(vt::count.Get(*record), data.size());
+    EXPECT_TRUE(std::ranges::equal(vt::data.View(*record), data));
+    EXPECT_TRUE(vt::data.Validate(*record, record.GetByteSize()).has_value());
+}
+
+TEST(RecordBuilder, BuildEmpty) {
+    const auto record {MakeRecordBuilder(vt::data).Build({})};
+    EXPECT_EQ(record.GetByteSize(), sizeof(Record));
+    EXPECT_EQ(vt::count.Get(*record), 0);
+    EXPECT_TRUE(vt::data.View(*record).empty());
+}
+
+TEST(RecordBuilder, FixedCount) {
+    const std::vector<std::uint32_t> data {1, 2, 3};
+    const auto record {MakeRecordBuilder(vt::data_with_header).Build(data)};
+    EXPECT_EQ(vt::count.Get(*record), data.size() + 2);
+    EXPECT_TRUE(std::ranges::equal(vt::data_with_header.View(*record), data));
+}
+
+TEST(RecordBuilder, CountOutOfRange) {
+    constexpr auto max_count {std::numeric_limits<std::uint16_t>::max()};
+    EXPECT_EQ(vt::data.GetMaxCount(), max_count);
+    EXPECT_EQ(vt::data_with_header.GetMaxCount(), max_count - 2);
+
+    const auto builder {MakeRecordBuilder(vt::data_with_header)};
+    const std::vector<std::uint32_t> data(max_count - 1);
+    EXPECT_THROW(builder.Build(data), std::length_error);
+
+    const auto record {builder.Build(std::span {data}.first(max_count - 2))};
+    EXPECT_EQ(vt::count.Get(*record), max_count);
+}
+
+TEST(RecordBuilder, Arena) {
+    alignas(Record) std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena {buffer.data(), buffer.size(),
+                                               std::pmr::null_memory_resource()};
+    const auto builder {MakeRecordBuilder(vt::data, &arena)};
+
+    const std::vector<std::uint32_t> data {1, 2, 3};
+    const auto record {builder.Build(data)};
+    const auto addr {reinterpret_cast<const std::byte*>(record.Get())};
+    EXPECT_GE(addr, buffer.data());
+    EXPECT_LE(addr + record.GetByteSize(), buffer.data() + buffer.size());
+    EXPECT_TRUE(std::ranges::equal(vt::data.View(*record), data));
+
+    EXPECT_THROW(builder.Build(std::vector<std::uint32_t>(buffer.size())), std::bad_alloc);
+}
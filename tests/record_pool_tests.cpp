@@ -0,0 +1,161 @@
+#include "field_access_proxy/record_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+using namespace field_access_proxy;
+
+namespace {
+
+#pragma pack(push, 1)
+
+struct Record {
+    std::uint32_t id {0};
+    std::uint16_t count {0};
+    std::uint32_t first_data[1];
+};
+
+#pragma pack(pop)
+
+namespace vt {
+
+constexpr auto count {MakeField("The number of data", &Record::count)};
+constexpr auto data {MakeFlexibleArrayField("Data", &Record::first_data, count)};
+
+}  // namespace vt
+
+//! A memory resource counting allocations from its upstream resource.
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocation_count {0};
+    std::size_t deallocation_count {0};
+
+private:
+    void* do_allocate(const std::size_t size, const std::size_t align) override {
+        ++allocation_count;
+        return std::pmr::new_delete_resource()->allocate(size, align);
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size, const std::size_t align) override {
+        ++deallocation_count;
+        std::pmr::new_delete_resource()->deallocate(ptr, size, align);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+}  // namespace
+
+TEST(RecordPool, SizeClass) {
+    auto pool {MakeRecordPool(vt::data)};
+    EXPECT_EQ(pool.GetSizeClass(0), 0);
+    EXPECT_EQ(pool.GetSizeClass(vt::data.GetByteSize(0)), 0);
+    EXPECT_GE(pool.GetClassByteSize(0), sizeof(Record));
+
+    for (std::size_t count {0}; count != 100; ++count) {
+        const auto size {vt::data.GetByteSize(count)};
+        const auto cls {pool.GetSizeClass(size)};
+        EXPECT_GE(pool.GetClassByteSize(cls), size);
+        if (cls != 0) {
+            // The size class is the smallest one that can hold the record.
+            EXPECT_LT(pool.GetClassByteSize(cls - 1), size);
+        }
+    }
+}
+
+TEST(RecordPool, Build) {
+    auto pool {MakeRecordPool(vt::data)};
+    const auto builder {MakeRecordBuilder(vt::data, &pool)};
+
+    const std::vector<std::uint32_t> data {1, 2, 3, 4, 5};
+    const auto record {builder.Build(data)};
+    EXPECT_EQ(vt::count.Get(*record), data.size());
+    EXPECT_TRUE(std::ranges::equal(vt::data.View(*record), data));
+
+    const auto copy {builder.Copy(*record)};
+    EXPECT_NE(copy.Get(), record.Get());
+    EXPECT_EQ(copy.GetByteSize(), record.GetByteSize());
+    EXPECT_TRUE(std::ranges::equal(vt::data.View(*copy), data));
+}
+
+TEST(RecordPool, ReuseFreedRecords) {
+    auto pool {MakeRecordPool(vt::data)};
+    const auto builder {MakeRecordBuilder(vt::data, &pool)};
+
+    auto record {builder.Build(std::vector<std::uint32_t> {1, 2, 3})};
+    const auto addr {record.Get()};
+    record.Reset();
+
+    // A record of the same size class reuses the freed memory.
+    record = builder.Build(std::vector<std::uint32_t> {1, 2, 3, 4});
+    EXPECT_EQ(record.Get(), addr);
+}
+
+TEST(RecordPool, Reset) {
+    CountingResource upstream;
+    auto pool {MakeRecordPool(vt::data, 1024, &upstream)};
+    const auto builder {MakeRecordBuilder(vt::data, &pool)};
+    const std::vector<std::uint32_t> data(16);
+
+    for (std::size_t batch {0}; batch != 10; ++batch) {
+        for (std::size_t i {0}; i != 100; ++i) {
+            builder.Build(data).Release();
+        }
+
+        pool.Reset();
+    }
+
+    // Arena chunks are only allocated in the first batch.
+    EXPECT_GT(upstream.allocation_count, 0);
+    const auto count {upstream.allocation_count};
+    for (std::size_t i {0}; i != 100; ++i) {
+        builder.Build(data).Release();
+    }
+
+    EXPECT_EQ(upstream.allocation_count, count);
+}
+
+TEST(RecordPool, Reserve) {
+    CountingResource upstream;
+    auto pool {MakeRecordPool(vt::data, 1024, &upstream)};
+    pool.Reserve(64 * 1024);
+    EXPECT_EQ(upstream.allocation_count, 1);
+
+    const auto builder {MakeRecordBuilder(vt::data, &pool)};
+    for (std::size_t i {0}; i != 100; ++i) {
+        builder.Build(std::vector<std::uint32_t>(16)).Release();
+    }
+
+    EXPECT_EQ(upstream.allocation_count, 1);
+}
+
+TEST(RecordPool, LargeRecord) {
+    auto pool {MakeRecordPool(vt::data, 64)};
+    const auto builder {MakeRecordBuilder(vt::data, &pool)};
+    const std::vector<std::uint32_t> data(1000, 1);
+    const auto record {builder.Build(data)};
+    EXPECT_TRUE(std::ranges::equal(vt::data.View(*record), data));
+}
+
+TEST(RecordPool, OverAligned) {
+    CountingResource upstream;
+    auto pool {MakeRecordPool(vt::data, 1024, &upstream)};
+    pool.Reserve(1024);
+    EXPECT_EQ(upstream.allocation_count, 1);
+
+    // Stricter alignments are served by the upstream resource instead of arena chunks.
+    constexpr std::size_t align {64};
+    const auto ptr {pool.allocate(100, align)};
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % align, 0);
+    EXPECT_EQ(upstream.allocation_count, 2);
+
+    pool.deallocate(ptr, 100, align);
+    EXPECT_EQ(upstream.deallocation_count, 1);
+}